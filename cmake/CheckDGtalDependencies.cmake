@@ -25,6 +25,14 @@ find_package(ZLIB REQUIRED)
 target_link_libraries(DGtal PUBLIC ZLIB::ZLIB)
 set(DGtalLibDependencies ${DGtalLibDependencies} ${ZLIB_LIBRARIES})
 
+# -----------------------------------------------------------------------------
+# Looking for threads (ThreadPool)
+# -----------------------------------------------------------------------------
+set(THREADS_PREFER_PTHREAD_FLAG ON)
+find_package(Threads REQUIRED)
+target_link_libraries(DGtal PUBLIC Threads::Threads)
+set(DGtalLibDependencies ${DGtalLibDependencies} ${CMAKE_THREAD_LIBS_INIT})
+
 # -----------------------------------------------------------------------------
 # Setting librt dependency on Linux
 # -----------------------------------------------------------------------------
@@ -0,0 +1,332 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file CompressedRows.h
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module CompressedRows.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(CompressedRows_RECURSES)
+#error Recursive header files inclusion detected in CompressedRows.h
+#else // defined(CompressedRows_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define CompressedRows_RECURSES
+
+#if !defined CompressedRows_h
+/** Prevents repeated inclusion of headers. */
+#define CompressedRows_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+#include <type_traits>
+#include <boost/iterator/counting_iterator.hpp>
+#include <boost/iterator/transform_iterator.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ThreadPool.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class CompressedRows
+  /**
+   * Description of template class 'CompressedRows' <p>
+   * \brief Aim: Stores a sequence of rows of values (e.g. the
+   * vertices of each face of a mesh) in a single array, in the
+   * compressed sparse row (CSR) layout, instead of a vector of
+   * vectors.
+   *
+   * Rows are accessed as light ranges (RowRange) pointing into the
+   * array, with the interface of a constant std::vector (begin, end,
+   * size, operator[], front, back), and implicitly convertible to
+   * std::vector. Building the rows thus needs a few large allocations
+   * instead of one per row, and traversals read contiguous memory.
+   *
+   * Rows are built either by appending them one after the other
+   * (appendRow), by giving all their sizes before filling them
+   * (resizeRows), or in parallel by a function computing each row
+   * (buildRows). Values can be modified in place. Rows can also grow
+   * (pushBack) or shrink (popBack): a row which outgrows its capacity
+   * is moved at the end of the array, leaving a hole that compact()
+   * removes.
+   *
+   * @note Like std::vector iterators, row ranges are invalidated when
+   * rows are added or grow.
+   *
+   * @tparam TValue the type of the values, default constructible and
+   * copyable.
+   *
+   * @see SurfaceMesh, testCompressedRows.cpp
+   */
+  template <typename TValue>
+  class CompressedRows
+  {
+  public:
+    typedef TValue Value;
+    typedef CompressedRows<TValue> Self;
+    typedef std::size_t Size;
+    typedef std::size_t Index;
+
+    /**
+     * A range of contiguous values, i.e. one row of the table.
+     * @tparam V Value or const Value.
+     */
+    template <typename V>
+    struct RowRange
+    {
+      typedef typename std::remove_const<V>::type value_type;
+      typedef V* iterator;
+      typedef V* const_iterator;
+      typedef V& reference;
+      typedef V& const_reference;
+      typedef std::size_t size_type;
+
+      RowRange() = default;
+      RowRange( V* aBegin, V* aEnd ) : myBegin( aBegin ), myEnd( aEnd ) {}
+      /// Rows are converted to constant rows.
+      template <typename W>
+      RowRange( const RowRange<W> & other ) : myBegin( other.begin() ), myEnd( other.end() ) {}
+      /// Rows are converted to vectors by copy.
+      operator std::vector<value_type>() const
+      { return std::vector<value_type>( myBegin, myEnd ); }
+
+      iterator begin() const        { return myBegin; }
+      iterator end() const          { return myEnd; }
+      const_iterator cbegin() const { return myBegin; }
+      const_iterator cend() const   { return myEnd; }
+      size_type size() const        { return size_type( myEnd - myBegin ); }
+      bool empty() const            { return myBegin == myEnd; }
+      V* data() const               { return myBegin; }
+      reference operator[]( size_type i ) const { return myBegin[ i ]; }
+      reference front() const       { return *myBegin; }
+      reference back() const        { return *( myEnd - 1 ); }
+
+      /// @return 'true' if both rows have the same values.
+      template <typename W>
+      bool operator==( const RowRange<W> & other ) const
+      {
+        return size() == other.size() && std::equal( myBegin, myEnd, other.begin() );
+      }
+      template <typename W>
+      bool operator!=( const RowRange<W> & other ) const { return ! ( *this == other ); }
+      /// @return 'true' if the row has the values of the vector.
+      bool operator==( const std::vector<value_type> & other ) const
+      {
+        return size() == other.size() && std::equal( myBegin, myEnd, other.begin() );
+      }
+      bool operator!=( const std::vector<value_type> & other ) const { return ! ( *this == other ); }
+
+    private:
+      V* myBegin = nullptr;
+      V* myEnd   = nullptr;
+    };
+
+    typedef RowRange<Value>       Row;
+    typedef RowRange<const Value> ConstRow;
+
+    /// Gives the constant row of an index.
+    struct ConstRowAt
+    {
+      const Self * table = nullptr;
+      ConstRow operator()( Index i ) const { return (*table)[ i ]; }
+    };
+
+    typedef boost::transform_iterator< ConstRowAt, boost::counting_iterator<Index>,
+                                       ConstRow, ConstRow > ConstIterator;
+    typedef ConstIterator const_iterator;
+    typedef ConstRow value_type;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /// Default constructor. The table has no rows.
+    CompressedRows() = default;
+
+    /**
+     * Constructor from a range of rows.
+     * @tparam RowIterator an iterator on ranges of values.
+     * @param itRow an iterator on the first row.
+     * @param itRowEnd an iterator after the last row.
+     */
+    template <typename RowIterator>
+    CompressedRows( RowIterator itRow, RowIterator itRowEnd );
+
+    /**
+     * Constructor from a vector of rows.
+     * @param rows a vector of vectors of values.
+     */
+    CompressedRows( const std::vector< std::vector<Value> > & rows );
+
+    /// Removes all the rows.
+    void clear();
+
+    /// @param nbValues the total number of values to reserve memory for.
+    void reserve( Size nbValues );
+
+    // ----------------------- Building rows ----------------------------------
+  public:
+
+    /**
+     * Appends a row.
+     * @tparam ValueIterator an iterator on values.
+     * @param itValue an iterator on the first value of the row.
+     * @param itValueEnd an iterator after the last value of the row.
+     * @return the index of the new row.
+     */
+    template <typename ValueIterator>
+    Index appendRow( ValueIterator itValue, ValueIterator itValueEnd );
+
+    /**
+     * Replaces all the rows by rows of the given sizes, whose values
+     * are default values, ready to be filled (possibly in parallel)
+     * through the mutable rows.
+     *
+     * @param sizes the size of each row.
+     */
+    void resizeRows( const std::vector<Size> & sizes );
+
+    /**
+     * Replaces all the rows by rows computed in parallel on the default
+     * ThreadPool. Each row is computed by a call `f( i, out )` that
+     * appends the values of row @a i to the vector @a out, which holds
+     * other rows computed by the same thread. Rows are then copied in
+     * the table.
+     *
+     * @tparam RowFunction the type of @a f.
+     * @param nbRows the number of rows.
+     * @param f the function computing the rows, which must not throw.
+     * @param grain the number of consecutive rows computed by a task.
+     */
+    template <typename RowFunction>
+    void buildRows( Size nbRows, RowFunction f, Size grain = 256 );
+
+    /**
+     * Adds a value at the end of a row.
+     * @param i the index of a row.
+     * @param v any value.
+     */
+    void pushBack( Index i, const Value & v );
+
+    /**
+     * Removes the last value of a row.
+     * @param i the index of a non empty row.
+     */
+    void popBack( Index i );
+
+    /// Removes the holes left by rows which have grown.
+    void compact();
+
+    // ----------------------- Accessors --------------------------------------
+  public:
+
+    /// @return the number of rows.
+    Size size() const;
+
+    /// @return 'true' if there is no row.
+    bool empty() const;
+
+    /// @return the total number of values in the rows.
+    Size nbValues() const;
+
+    /// @return the number of bytes used by the table.
+    Size memory() const;
+
+    /// @param i the index of a row.
+    /// @return the row @a i.
+    ConstRow operator[]( Index i ) const;
+
+    /// @param i the index of a row.
+    /// @return the row @a i, whose values can be modified.
+    Row operator[]( Index i );
+
+    /// @return an iterator on the first row.
+    ConstIterator begin() const;
+
+    /// @return an iterator after the last row.
+    ConstIterator end() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The position, size and capacity of a row in the array.
+    struct RowInfo
+    {
+      Index begin;
+      DGtal::uint32_t size;
+      DGtal::uint32_t capacity;
+    };
+
+    /// The values of all the rows.
+    std::vector<Value> myValues;
+
+    /// The position, size and capacity of each row.
+    std::vector<RowInfo> myRows;
+
+    /// The total number of values in the rows.
+    Size myNbValues = 0;
+
+  }; // end of class CompressedRows
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'CompressedRows'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'CompressedRows' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TValue>
+  std::ostream&
+  operator<< ( std::ostream & out, const CompressedRows<TValue> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/base/CompressedRows.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined CompressedRows_h
+
+#undef CompressedRows_RECURSES
+#endif // else defined(CompressedRows_RECURSES)
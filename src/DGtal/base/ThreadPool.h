@@ -0,0 +1,262 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ThreadPool.h
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module ThreadPool.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ThreadPool_RECURSES)
+#error Recursive header files inclusion detected in ThreadPool.h
+#else // defined(ThreadPool_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ThreadPool_RECURSES
+
+#if !defined ThreadPool_h
+/** Prevents repeated inclusion of headers. */
+#define ThreadPool_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <exception>
+#include <cstddef>
+#include <utility>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class ThreadPool
+  /**
+   * Description of class 'ThreadPool' <p>
+   * \brief Aim: A minimal pool of persistent worker threads used to
+   * run data-parallel loops without any OpenMP support.
+   *
+   * The pool owns `size()-1` worker threads, the calling thread
+   * taking part in each parallel loop with rank 0. Each loop is
+   * split into blocks of consecutive indices (the grain) which are
+   * dynamically distributed to the threads. The loop body receives
+   * the index and the rank of the thread running it (in `[0,size())`),
+   * so that algorithms can keep per-thread scratch buffers.
+   *
+   * A process-wide pool is available through defaultPool(). Its size
+   * is by default the number of hardware threads and can be changed
+   * with setDefaultNumberOfThreads(). Nested calls to parallelFor (i.e. from
+   * the body of a running loop) are run sequentially by the calling
+   * thread, with its own rank.
+   *
+   * @code
+   * ThreadPool & pool = ThreadPool::defaultPool();
+   * std::vector< std::vector<int> > scratch( pool.size() );
+   * pool.parallelFor( n, [&] ( std::size_t i, unsigned int rank )
+   *                   { doSomething( i, scratch[ rank ] ); } );
+   * @endcode
+   *
+   * @note loop bodies must be safe to run concurrently on distinct
+   * indices.
+   *
+   * @see testThreadPool.cpp
+   */
+  class ThreadPool
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param nbThreads the number of threads participating to parallel
+     * loops (including the calling thread). If 0, the number of
+     * hardware threads is used.
+     */
+    explicit ThreadPool( unsigned int nbThreads = 0 );
+
+    /**
+     * Destructor. Joins the worker threads.
+     */
+    ~ThreadPool();
+
+    ThreadPool( const ThreadPool & other ) = delete;
+    ThreadPool & operator=( const ThreadPool & other ) = delete;
+
+    /**
+     * @return the process-wide pool used by default by DGtal
+     * multithreaded algorithms.
+     */
+    static ThreadPool & defaultPool();
+
+    /**
+     * Resizes the process-wide pool. Must not be called while the
+     * default pool is running a loop.
+     *
+     * @param nbThreads the number of threads (0 means the number of
+     * hardware threads).
+     */
+    static void setDefaultNumberOfThreads( unsigned int nbThreads );
+
+    /**
+     * @return the number of hardware threads (at least 1).
+     */
+    static unsigned int hardwareConcurrency();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @return the number of threads participating to parallel loops,
+     * i.e. an upper bound on the thread ranks given to loop bodies.
+     */
+    unsigned int size() const;
+
+    /**
+     * Runs `f( i, rank )` for all `i` in `[0,nb)`. Indices are
+     * distributed by blocks of @a grain consecutive values. The call
+     * returns when all indices have been processed.
+     *
+     * @tparam TFunction a callable type `void( std::size_t, unsigned int )`.
+     * @param nb the number of indices.
+     * @param f the loop body.
+     * @param grain the number of consecutive indices processed as one task.
+     */
+    template <typename TFunction>
+    void parallelFor( std::size_t nb, TFunction && f, std::size_t grain = 1 );
+
+    /**
+     * Runs `f( s, rank )` for all slabs `s` in `[0,nb)`, where slabs
+     * are consecutive ranges of @a slabSize values of a container
+     * (the last one may be shorter). If the values are packed into
+     * 64-bit words (e.g. std::vector<bool>), two consecutive slabs
+     * may share a word and are never run concurrently: even slabs are
+     * processed, then odd slabs, or all slabs sequentially when they
+     * are shorter than a word.
+     *
+     * @tparam TFunction a callable type `void( std::size_t, unsigned int )`.
+     * @param nb the number of slabs.
+     * @param slabSize the number of values of a (full) slab.
+     * @param packed 'true' iff values are packed into words.
+     * @param f the loop body, writing the values of a slab.
+     */
+    template <typename TFunction>
+    void parallelForSlabs( std::size_t nb, std::size_t slabSize, bool packed,
+                           TFunction && f );
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private services -----------------------------
+  private:
+
+    /**
+     * Body of a worker thread.
+     * @param rank the rank of the worker.
+     * @param generation the job generation when the worker was started.
+     */
+    void workerLoop( unsigned int rank, std::size_t generation );
+
+    /// Starts the worker threads.
+    void start( unsigned int nbThreads );
+
+    /// Stops and joins the worker threads.
+    void stop();
+
+    /// The pool whose loop body is run by a thread, with the thread rank.
+    typedef std::pair<const ThreadPool*, unsigned int> Context;
+
+    /// @return a reference to the context of the current thread (the
+    /// pool is null if the thread is not running a loop body).
+    static Context & currentContext();
+
+    /// @return the storage of the process-wide pool.
+    static std::unique_ptr<ThreadPool> & defaultPoolStorage();
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Number of threads participating to loops (workers + caller).
+    unsigned int mySize;
+    /// Worker threads.
+    std::vector<std::thread> myWorkers;
+    /// Protects the job state below.
+    std::mutex myMutex;
+    /// Wakes up workers when a job is posted.
+    std::condition_variable myJobPosted;
+    /// Wakes up the caller when the workers are done.
+    std::condition_variable myJobDone;
+    /// Job currently run (takes the thread rank).
+    std::function<void( unsigned int )> myJob;
+    /// Incremented each time a new job is posted.
+    std::size_t myGeneration;
+    /// Number of workers still running the current job.
+    unsigned int myPending;
+    /// True when the workers must exit.
+    bool myStop;
+    /// First exception thrown by a loop body, rethrown by the caller.
+    std::exception_ptr myException;
+    /// Serializes concurrent calls to parallelFor from distinct threads.
+    std::mutex myCallMutex;
+
+  }; // end of class ThreadPool
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ThreadPool'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ThreadPool' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const ThreadPool & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/base/ThreadPool.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ThreadPool_h
+
+#undef ThreadPool_RECURSES
+#endif // else defined(ThreadPool_RECURSES)
@@ -169,6 +169,12 @@ namespace DGtal
     PrimalForm0           former_v0;
     /// The primal 0-form lambda/(4epsilon) (stored for performance)
     PrimalForm0           l_1_over_4e;
+    /// The solver for u, kept across iterations since its operators
+    /// share the same sparsity pattern (only refactorized numerically).
+    SolverU2              solver_u2;
+    /// The solver for v, kept across iterations since its operators
+    /// share the same sparsity pattern (only refactorized numerically).
+    SolverV0              solver_v0;
 
   public:
     // The map Surfel -> Index that gives the index of the surfel in 2-forms.
@@ -553,7 +559,6 @@ namespace DGtal
         + primal_AD2.transpose() * dec_helper::diagonal( v1_squared ) * primal_AD2;
 
       if ( verbose >= 2 ) trace.info() << "Prefactoring matrix U associated to u" << std::endl;
-      SolverU2 solver_u2;
       solver_u2.compute( ope_u2 );
       for ( Dimension d = 0; d < u2.size(); ++d )
         {
@@ -576,7 +581,6 @@ namespace DGtal
 	+ M01.transpose() * dec_helper::diagonal( squared_norm_d_u2 ) * M01;
 
       if ( verbose >= 2 ) trace.info() << "Prefactoring matrix V associated to v" << std::endl;
-      SolverV0 solver_v0;
       solver_v0.compute( ope_v0 );
       if ( verbose >= 2 ) trace.info() << "Solving V v = l/4e * 1" << std::endl;
       v0 = solver_v0.solve( l_1_over_4e );
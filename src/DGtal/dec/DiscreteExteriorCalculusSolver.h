@@ -46,6 +46,7 @@
 #include "DGtal/base/Clone.h"
 #include "DGtal/dec/KForm.h"
 #include "DGtal/dec/LinearOperator.h"
+#include "DGtal/math/linalg/SparseFactorizationCache.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -58,6 +59,11 @@ namespace DGtal
    * \brief Aim:
    * This wraps a linear algebra solver around a discrete exterior calculus.
    *
+   * When the linear algebra solver has separate symbolic and numeric
+   * factorizations (e.g. Eigen's Simplicial solvers), successive calls
+   * to compute() with operators sharing the same sparsity pattern
+   * (e.g. in iterative schemes) only redo the numeric factorization.
+   *
    * @tparam TCalculus should be DiscreteExteriorCalculus.
    * @tparam TLinearAlgebraSolver should be a model of CLinearAlgebraSolver.
    * @tparam order_in is the input order of the linear problem.
@@ -81,6 +87,7 @@ namespace DGtal
     typedef LinearOperator<Calculus, order_in, duality_in, order_out, duality_out> Operator;
     typedef KForm<Calculus, order_in, duality_in> SolutionKForm;
     typedef KForm<Calculus, order_out, duality_out> InputKForm;
+    typedef SparseFactorizationCache<typename Calculus::LinearAlgebraBackend, LinearAlgebraSolver> Factorizations;
 
     /**
      * Constructor.
@@ -106,12 +113,20 @@ namespace DGtal
     void selfDisplay(std::ostream& out) const;
 
     /**
-     * Prefactorize problem / set problem operator.
+     * Prefactorize problem / set problem operator. The symbolic
+     * analysis of the previous operator is reused when both operators
+     * have the same sparsity pattern.
      * @param linear_operator linear operator.
      * @return *this.
      */
     DiscreteExteriorCalculusSolver& compute(const Operator& linear_operator);
 
+    /**
+     * @return the number of symbolic analyses (sparsity pattern
+     * orderings) done by the calls to compute.
+     */
+    std::size_t nbSymbolicAnalyses() const;
+
     /**
      * Solve prefactorized / set problem input.
      * @param input_kform input k-form.
@@ -127,6 +142,15 @@ namespace DGtal
 
     // ------------------------- Private Datas --------------------------------
   private:
+    /**
+     * Sparsity pattern of the last factorized operator.
+     */
+    typename Factorizations::SparsityPattern myPattern;
+
+    /**
+     * Number of symbolic analyses.
+     */
+    std::size_t myNbSymbolicAnalyses;
 
     // ------------------------- Hidden services ------------------------------
   protected:
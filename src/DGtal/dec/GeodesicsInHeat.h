@@ -41,9 +41,12 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/ThreadPool.h"
 #include "DGtal/math/linalg/DirichletConditions.h"
+#include "DGtal/math/linalg/SparseFactorizationCache.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -73,6 +76,10 @@ namespace DGtal
     typedef typename PolygonalCalculus::LinAlg LinAlgBackend;
     typedef DirichletConditions< LinAlgBackend > Conditions;
     typedef typename Conditions::IntegerVector IntegerVector;
+    /// Factorizations of the heat operators, keyed by (dt, lambda).
+    typedef SparseFactorizationCache< LinAlgBackend, Solver, std::pair<double,double> > HeatFactorizations;
+    /// Factorizations of the Laplacian, keyed by lambda.
+    typedef SparseFactorizationCache< LinAlgBackend, Solver, double > PoissonFactorizations;
     
     /**
      * Default constructor.
@@ -81,7 +88,9 @@ namespace DGtal
     
     /// Constructor from an existing polygonal calculus. T
     /// @param calculus a instance of PolygonalCalculus
-    GeodesicsInHeat(ConstAlias<PolygonalCalculus> calculus): myCalculus(&calculus)
+    GeodesicsInHeat(ConstAlias<PolygonalCalculus> calculus)
+      : myCalculus(&calculus), myHeatSolvers( 4 ), myHeatDirichletSolvers( 4 ),
+        myPoissonSolvers( 1 )
     {
       myIsInit=false;
     }
@@ -132,27 +141,35 @@ namespace DGtal
     /// surface has boundaries, mix two solutions of the heat
     /// diffusion operation (Neumann and Dirichlet null conditions on
     /// boundary).
+    ///
+    /// The factorizations of the last few (dt, lambda) pairs are kept,
+    /// so that calling init again with one of them costs no
+    /// factorization, and the others share the symbolic analysis of
+    /// the operators (see SparseFactorizationCache). Call
+    /// clearFactorizations() if the calculus has changed in between.
     void init( double dt, double lambda = 1.0,
                bool boundary_with_mixed_solution = false  )
     {
       myIsInit = true;
       myLambda = lambda;
+      const std::pair<double,double> key( dt, lambda );
 
       SparseMatrix laplacian = myCalculus->globalLaplaceBeltrami( lambda );
       SparseMatrix mass      = myCalculus->globalLumpedMassMatrix();
       myHeatOpe              = mass - dt*laplacian;
     
-      // from https://geometry-central.net
-      // NOTE: In theory, it should not be necessary to shift the Laplacian: the Polydec Laplace is always PSD. However, when the
-      // matrix is only positive SEMIdefinite, some solvers may not work (ie Eigen's Cholesky solver doesn't work, but
-      // Suitesparse does).
-      SparseMatrix Id = SparseMatrix(myCalculus->nbVertices(),myCalculus->nbVertices());
-      Id.setIdentity();
-      laplacian += 1e-6 * Id;
-      
       //Prefactorizing
-      myPoissonSolver.compute( laplacian );
-      myHeatSolver.compute   ( myHeatOpe );
+      myPoissonSolver = &myPoissonSolvers.get( lambda, [&] ()
+        {
+          // from https://geometry-central.net
+          // NOTE: In theory, it should not be necessary to shift the Laplacian: the Polydec Laplace is always PSD. However, when the
+          // matrix is only positive SEMIdefinite, some solvers may not work (ie Eigen's Cholesky solver doesn't work, but
+          // Suitesparse does).
+          SparseMatrix Id = SparseMatrix(myCalculus->nbVertices(),myCalculus->nbVertices());
+          Id.setIdentity();
+          return SparseMatrix( laplacian + 1e-6 * Id );
+        } );
+      myHeatSolver = &myHeatSolvers.get( key, [&] () { return myHeatOpe; } );
       
       //empty source
       mySource    = Vector::Zero(myCalculus->nbVertices());
@@ -172,9 +189,20 @@ namespace DGtal
       myManageBoundary = ! edges.empty();
       if ( ! myManageBoundary ) return;
       // Prepare solver for a problem with Dirichlet conditions.
-      SparseMatrix heatOpe_d = Conditions::dirichletOperator( myHeatOpe, myBoundary );
-      // Prefactoring
-      myHeatDirichletSolver.compute( heatOpe_d );
+      myHeatDirichletSolver = &myHeatDirichletSolvers.get( key, [&] ()
+        { return Conditions::dirichletOperator( myHeatOpe, myBoundary ); } );
+    }
+
+    /// Forgets the factorizations kept by init (e.g. when the
+    /// underlying calculus has changed).
+    void clearFactorizations()
+    {
+      myIsInit = false;
+      myFaceGradients.clear();
+      myFaceDivergences.clear();
+      myHeatSolvers.clear();
+      myHeatDirichletSolvers.clear();
+      myPoissonSolvers.clear();
     }
     
     /** Adds a source point at a vertex @e aV
@@ -210,8 +238,8 @@ namespace DGtal
     {
       FATAL_ERROR_MSG(myIsInit, "init() method must be called first");
       //Heat diffusion
-      Vector heatDiffusion = myHeatSolver.solve(mySource);
-      ASSERT(myHeatSolver.info()==Eigen::Success);
+      Vector heatDiffusion = myHeatSolver->solve(mySource);
+      ASSERT(myHeatSolver->info()==Eigen::Success);
 
       // Take care of boundaries
       if ( myManageBoundary )
@@ -219,7 +247,7 @@ namespace DGtal
           Vector bValues  = Vector::Zero( myCalculus->nbVertices() );
           Vector bSources = Conditions::dirichletVector( myHeatOpe, mySource,
                                                          myBoundary, bValues );
-          Vector bSol     = myHeatDirichletSolver.solve( bSources );
+          Vector bSol     = myHeatDirichletSolver->solve( bSources );
           Vector heatDiffusionDirichlet
                           = Conditions::dirichletSolution( bSol, myBoundary, bValues );
           heatDiffusion = 0.5 * ( heatDiffusion + heatDiffusionDirichlet );
@@ -255,8 +283,8 @@ namespace DGtal
         }
       
       // Last Poisson solve
-      Vector distVec = myPoissonSolver.solve(divergence);
-      ASSERT(myPoissonSolver.info()==Eigen::Success);
+      Vector distVec = myPoissonSolver->solve(divergence);
+      ASSERT(myPoissonSolver->info()==Eigen::Success);
 
       //Source val
       auto sourceval = distVec(myLastSourceIndex);
@@ -265,6 +293,130 @@ namespace DGtal
     }
     
     
+    /// Computes the geodesic distances from several source sets at
+    /// once, i.e. the result of compute() for each of them (up to
+    /// rounding errors). The heat and Poisson systems are solved for
+    /// blocks of @a batchSize right-hand sides at a time, blocks being
+    /// processed in parallel on the default ThreadPool, and the per
+    /// face gradient and divergence operators are computed once (see
+    /// precomputeFaceOperators).
+    ///
+    /// @note the memory used is about three dense matrices of
+    /// nbVertices x batchSize per thread, plus the result.
+    ///
+    /// @param sourceSets a range of non-empty sets of source vertices.
+    /// @param batchSize the number of source sets solved together.
+    /// @returns a nbVertices x sourceSets.size() matrix whose j-th
+    /// column is the estimated geodesic distance from the j-th source
+    /// set (shifted to be 0 at its last vertex, as in compute()).
+    DenseMatrix computeBatch( const std::vector< std::vector< Vertex > > & sourceSets,
+                              std::size_t batchSize = 16 ) const
+    {
+      FATAL_ERROR_MSG(myIsInit, "init() method must be called first");
+      precomputeFaceOperators();
+      typedef typename DenseMatrix::Index Index;
+      const Index n = myCalculus->nbVertices();
+      const std::size_t k = sourceSets.size();
+      batchSize = std::max( batchSize, std::size_t( 1 ) );
+      // rows of the system with Dirichlet conditions.
+      std::vector< Index > interior;
+      if ( myManageBoundary )
+        for ( Index i = 0; i < n; i++ )
+          if ( myBoundary[ i ] == 0 ) interior.push_back( i );
+      const auto surfmesh = myCalculus->getSurfaceMeshPtr();
+      const Index nbFaces = Index( myCalculus->nbFaces() );
+      DenseMatrix distances( n, k );
+      const std::size_t nbBatches = ( k + batchSize - 1 ) / batchSize;
+      ThreadPool::defaultPool().parallelFor( nbBatches, [&] ( std::size_t b, unsigned int )
+        {
+          const std::size_t first = b * batchSize;
+          const Index m = Index( std::min( batchSize, k - first ) );
+          DenseMatrix sources = DenseMatrix::Zero( n, m );
+          for ( Index j = 0; j < m; j++ )
+            {
+              ASSERT_MSG( ! sourceSets[ first + j ].empty(), "Source sets must not be empty" );
+              for ( auto v : sourceSets[ first + j ] ) sources( v, j ) = 1.0;
+            }
+          //Heat diffusion
+          DenseMatrix heat = myHeatSolver->solve( sources );
+          if ( myManageBoundary )
+            { // null Dirichlet conditions on the boundary.
+              DenseMatrix bSources( Index( interior.size() ), m );
+              for ( Index i = 0; i < Index( interior.size() ); i++ )
+                bSources.row( i ) = sources.row( interior[ i ] );
+              const DenseMatrix bSol = myHeatDirichletSolver->solve( bSources );
+              DenseMatrix heatDirichlet = DenseMatrix::Zero( n, m );
+              for ( Index i = 0; i < Index( interior.size() ); i++ )
+                heatDirichlet.row( interior[ i ] ) = bSol.row( i );
+              heat = 0.5 * ( heat + heatDirichlet );
+            }
+          // Heat, normalization and divergence per face
+          DenseMatrix divergence = DenseMatrix::Zero( n, m );
+          DenseMatrix faceHeat, grad, faceDivergence;
+          for ( Index f = 0; f < nbFaces; ++f )
+            {
+              const auto vertices = surfmesh->incidentVertices( f );
+              const Index deg = Index( vertices.size() );
+              faceHeat.resize( deg, m );
+              for ( Index i = 0; i < deg; i++ )
+                faceHeat.row( i ) = heat.row( vertices[ i ] );
+              grad = -myFaceGradients[ f ] * faceHeat;
+              for ( Index j = 0; j < m; j++ ) grad.col( j ).normalize();
+              faceDivergence = myFaceDivergences[ f ] * grad;
+              for ( Index i = 0; i < deg; i++ )
+                divergence.row( vertices[ i ] ) += faceDivergence.row( i );
+            }
+          // Last Poisson solve
+          const DenseMatrix dist = myPoissonSolver->solve( divergence );
+          for ( Index j = 0; j < m; j++ )
+            {
+              //shifting the distances to get 0 at the last source
+              const double sourceval = dist( sourceSets[ first + j ].back(), j );
+              distances.col( first + j ) = dist.col( j ).array() - sourceval;
+            }
+        } );
+      return distances;
+    }
+
+    /// Computes the geodesic distances from several single sources
+    /// at once (see computeBatch above).
+    ///
+    /// @param sources a range of source vertices.
+    /// @param batchSize the number of sources solved together.
+    /// @returns a nbVertices x sources.size() matrix whose j-th column
+    /// is the estimated geodesic distance from the j-th source.
+    DenseMatrix computeBatch( const std::vector< Vertex > & sources,
+                              std::size_t batchSize = 16 ) const
+    {
+      std::vector< std::vector< Vertex > > sourceSets;
+      sourceSets.reserve( sources.size() );
+      for ( auto v : sources ) sourceSets.push_back( { v } );
+      return computeBatch( sourceSets, batchSize );
+    }
+
+    /// Computes and keeps the per face gradient operators and the
+    /// per face compositions of the divergence and flat operators
+    /// used by computeBatch, in parallel on the default ThreadPool
+    /// unless the internal cache of the calculus is enabled. Called
+    /// by computeBatch if needed (which is thus not safe to call
+    /// concurrently for the first time).
+    void precomputeFaceOperators() const
+    {
+      const std::size_t nbFaces = myCalculus->nbFaces();
+      if ( myFaceGradients.size() == nbFaces ) return;
+      myFaceGradients.resize( nbFaces );
+      myFaceDivergences.resize( nbFaces );
+      auto faceOperators = [&] ( std::size_t f, unsigned int )
+        {
+          myFaceGradients  [ f ] = myCalculus->gradient( f );
+          myFaceDivergences[ f ] = myCalculus->divergence( f ) * myCalculus->flat( f );
+        };
+      if ( myCalculus->isInternalGlobalCacheEnabled() )
+        for ( std::size_t f = 0; f < nbFaces; ++f ) faceOperators( f, 0 );
+      else
+        ThreadPool::defaultPool().parallelFor( nbFaces, faceOperators, 256 );
+    }
+
     /// @return true if the calculus is valid.
     bool isValid() const
     {
@@ -281,11 +433,20 @@ namespace DGtal
     /// The operator for heat diffusion.
     SparseMatrix myHeatOpe;
     
-    ///Poisson solver
-    Solver myPoissonSolver;
+    ///Factorizations of the heat operators
+    HeatFactorizations myHeatSolvers;
+
+    ///Factorizations of the heat operators with Dirichlet boundary conditions
+    HeatFactorizations myHeatDirichletSolvers;
 
-    ///Heat solver
-    Solver myHeatSolver;
+    ///Factorizations of the Laplacian
+    PoissonFactorizations myPoissonSolvers;
+
+    ///Poisson solver (in myPoissonSolvers)
+    const Solver* myPoissonSolver;
+
+    ///Heat solver (in myHeatSolvers)
+    const Solver* myHeatSolver;
 
     ///Source vector
     Vector mySource;
@@ -306,8 +467,14 @@ namespace DGtal
     /// The boundary characteristic vector
     IntegerVector myBoundary;
     
-    ///Heat solver with Dirichlet boundary conditions.
-    Solver myHeatDirichletSolver;
+    ///Heat solver with Dirichlet boundary conditions (in myHeatDirichletSolvers).
+    const Solver* myHeatDirichletSolver;
+
+    ///Per face gradient operators (see precomputeFaceOperators).
+    mutable std::vector< DenseMatrix > myFaceGradients;
+
+    ///Per face divergence of the flat operators (see precomputeFaceOperators).
+    mutable std::vector< DenseMatrix > myFaceDivergences;
   
   
   }; // end of class GeodesicsInHeat
@@ -1035,6 +1035,13 @@ public:
     myGlobalCacheEnabled = true;
   }
   
+  /// @return 'true' if the internal global cache for operators is
+  /// enabled (operators are then not safe to compute concurrently).
+  bool isInternalGlobalCacheEnabled() const
+  {
+    return myGlobalCacheEnabled;
+  }
+
   /// Disable the internal global cache for operators.
   /// This method will also clean up the
   void disableInternalGlobalCache()
@@ -44,6 +44,7 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConstAlias.h"
 #include "DGtal/math/linalg/DirichletConditions.h"
+#include "DGtal/math/linalg/SparseFactorizationCache.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -73,6 +74,8 @@ public:
     typedef typename PolygonalCalculus::LinAlg LinAlgBackend;
     typedef DirichletConditions< LinAlgBackend > Conditions;
     typedef typename Conditions::IntegerVector IntegerVector;
+    /// Factorizations of the heat operators, keyed by (dt, lambda).
+    typedef SparseFactorizationCache< LinAlgBackend, Solver, std::pair<double,double> > HeatFactorizations;
 
     /**
      * Default constructor.
@@ -81,7 +84,9 @@ public:
 
     /// Constructor from an existing polygonal calculus. T
     /// @param calculus a instance of PolygonalCalculus
-    VectorsInHeat(ConstAlias<PolygonalCalculus> calculus): myCalculus(&calculus)
+    VectorsInHeat(ConstAlias<PolygonalCalculus> calculus)
+      : myCalculus(&calculus), myScalarHeatSolvers( 4 ), myVectorHeatSolvers( 4 ),
+        myHeatDirichletSolvers( 4 )
     {
         myIsInit=false;
     }
@@ -131,10 +136,17 @@ public:
     /// surface has boundaries, mix two solutions of the heat
     /// diffusion operation (Neumann and Dirichlet null conditions on
     /// boundary).
+    ///
+    /// The factorizations of the last few (dt, lambda) pairs are kept,
+    /// so that calling init again with one of them costs no
+    /// factorization, and the others share the symbolic analysis of
+    /// the operators (see SparseFactorizationCache). Call
+    /// clearFactorizations() if the calculus has changed in between.
     void init( double dt, double lambda = 1.0,
                bool boundary_with_mixed_solution = false )
     {
         myIsInit=true;
+        const std::pair<double,double> key( dt, lambda );
 
         SparseMatrix laplacian = myCalculus->globalLaplaceBeltrami( lambda );
 
@@ -146,8 +158,8 @@ public:
         myVectorHeatOpe   =  mass2 - dt*connectionLaplacian;
 
         //Prefactorizing
-        myScalarHeatSolver.compute(myScalarHeatOpe);
-        myVectorHeatSolver.compute(myVectorHeatOpe);
+        myScalarHeatSolver = &myScalarHeatSolvers.get( key, [&] () { return myScalarHeatOpe; } );
+        myVectorHeatSolver = &myVectorHeatSolvers.get( key, [&] () { return myVectorHeatOpe; } );
 
         //empty sources
         myVectorSource     	= Vector::Zero(2*myCalculus->nbVertices());
@@ -169,9 +181,18 @@ public:
         myManageBoundary = ! edges.empty();
         if ( ! myManageBoundary ) return;
         // Prepare solver for a problem with Dirichlet conditions.
-        SparseMatrix heatOpe_d = Conditions::dirichletOperator( myScalarHeatOpe, myBoundary );
-        // Prefactoring
-        myHeatDirichletSolver.compute( heatOpe_d );
+        myHeatDirichletSolver = &myHeatDirichletSolvers.get( key, [&] ()
+          { return Conditions::dirichletOperator( myScalarHeatOpe, myBoundary ); } );
+    }
+
+    /// Forgets the factorizations kept by init (e.g. when the
+    /// underlying calculus has changed).
+    void clearFactorizations()
+    {
+        myIsInit = false;
+        myScalarHeatSolvers.clear();
+        myVectorHeatSolvers.clear();
+        myHeatDirichletSolvers.clear();
     }
 
     /** Adds a source vector (3D extrinsic) at a vertex @e aV
@@ -238,9 +259,9 @@ public:
     {
         FATAL_ERROR_MSG(myIsInit, "init() method must be called first");
         //Heat diffusion
-        Vector vectorHeatDiffusion = myVectorHeatSolver.solve(myVectorSource);
-        Vector scalarHeatDiffusion = myScalarHeatSolver.solve(myScalarSource);
-        Vector diracHeatDiffusion = myScalarHeatSolver.solve(myDiracSource);
+        Vector vectorHeatDiffusion = myVectorHeatSolver->solve(myVectorSource);
+        Vector scalarHeatDiffusion = myScalarHeatSolver->solve(myScalarSource);
+        Vector diracHeatDiffusion = myScalarHeatSolver->solve(myDiracSource);
         auto surfmesh = myCalculus->getSurfaceMeshPtr();
 
 
@@ -250,7 +271,7 @@ public:
           Vector bValues  = Vector::Zero( myCalculus->nbVertices() );
           Vector bNormSources = Conditions::dirichletVector( myScalarHeatOpe, myScalarSource,
                                                          myBoundary, bValues );
-          Vector bSol     = myHeatDirichletSolver.solve( bNormSources );
+          Vector bSol     = myHeatDirichletSolver->solve( bNormSources );
           Vector heatDiffusionDirichlet
                           = Conditions::dirichletSolution( bSol, myBoundary, bValues );
           scalarHeatDiffusion = 0.5 * ( scalarHeatDiffusion + heatDiffusionDirichlet );
@@ -287,9 +308,14 @@ private:
     SparseMatrix myScalarHeatOpe;
     SparseMatrix myVectorHeatOpe;
 
-    ///Heat solvers
-    Solver myScalarHeatSolver;
-    Solver myVectorHeatSolver;
+    ///Factorizations of the heat operators
+    HeatFactorizations myScalarHeatSolvers;
+    HeatFactorizations myVectorHeatSolvers;
+    HeatFactorizations myHeatDirichletSolvers;
+
+    ///Heat solvers (in the factorizations above)
+    const Solver* myScalarHeatSolver;
+    const Solver* myVectorHeatSolver;
 
     ///Source vectors
     Vector myScalarSource;
@@ -306,8 +332,8 @@ private:
     ///Validitate flag
     bool myIsInit;
 
-    ///Heat solver with Dirichlet boundary conditions.
-    Solver myHeatDirichletSolver;
+    ///Heat solver with Dirichlet boundary conditions (in myHeatDirichletSolvers).
+    const Solver* myHeatDirichletSolver;
 
 }; // end of class VectorsInHeat
 } // namespace DGtal
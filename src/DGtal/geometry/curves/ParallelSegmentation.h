@@ -0,0 +1,222 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ParallelSegmentation.h
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module ParallelSegmentation.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ParallelSegmentation_RECURSES)
+#error Recursive header files inclusion detected in ParallelSegmentation.h
+#else // defined(ParallelSegmentation_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ParallelSegmentation_RECURSES
+
+#if !defined ParallelSegmentation_h
+/** Prevents repeated inclusion of headers. */
+#define ParallelSegmentation_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <type_traits>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/IteratorCirculatorTraits.h"
+#include "DGtal/base/ThreadPool.h"
+#include "DGtal/geometry/curves/SegmentComputerUtils.h"
+#include "DGtal/geometry/curves/CForwardSegmentComputer.h"
+#include "DGtal/geometry/curves/GreedySegmentation.h"
+#include "DGtal/geometry/curves/SaturatedSegmentation.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ParallelSegmentation
+  /**
+   * Description of template class 'ParallelSegmentation' <p>
+   * \brief Aim: Computes the greedy segmentation or the saturated
+   * segmentation of a (very long) open or closed range with several
+   * threads, with exactly the same result as GreedySegmentation and
+   * SaturatedSegmentation on the whole range with their default mode.
+   *
+   * Both segmentations are chains of segments in which a segment is
+   * computed from the previous one only. The range is cut into
+   * chunks, which are processed in parallel with the default
+   * ThreadPool: the chain of each chunk starts at a segment computed
+   * from the first element of the chunk (the longest segment for the
+   * greedy segmentation, the first maximal segment for the saturated
+   * one) and stops when segments begin in the next chunk. Chunks are
+   * then merged in order: the exact chain coming from the previous
+   * chunks is extended until it meets a segment of the chain of the
+   * next chunk, which is then taken as is. For DSSs, both chains
+   * meet after a few segments, the serial work is thus very small.
+   *
+   * The range must be given by random access iterators or
+   * circulators, otherwise the serial segmentations are used. A
+   * closed range (circulators) is cut into chunks from its first
+   * element like an open range: the segments crossing its seam are
+   * the ones of the first and last chunks.
+   *
+   * @code
+   typedef ArithmeticalDSSComputer<std::vector<Z2i::Point>::const_iterator,int,4> DSSComputer;
+   ParallelSegmentation<DSSComputer> segmentation( contour.begin(), contour.end(), DSSComputer() );
+   std::vector<DSSComputer> maximalDSSs = segmentation.maximalSegments();
+   * @endcode
+   *
+   * @tparam TSegmentComputer at least a model of concepts::CForwardSegmentComputer.
+   *
+   * @see GreedySegmentation SaturatedSegmentation
+   */
+  template <typename TSegmentComputer>
+  class ParallelSegmentation
+  {
+  public:
+    BOOST_CONCEPT_ASSERT(( concepts::CForwardSegmentComputer<TSegmentComputer> ));
+    typedef TSegmentComputer SegmentComputer;
+    typedef typename SegmentComputer::ConstIterator ConstIterator;
+    typedef std::vector<SegmentComputer> Segments;
+    typedef std::size_t Size;
+
+    /// 'true' iff chunks are processed in parallel for this type of
+    /// iterators or circulators, 'false' if the serial segmentations
+    /// are used.
+    static constexpr bool isParallel =
+      std::is_same< typename IteratorCirculatorTraits<ConstIterator>::Category, RandomAccessCategory >::value;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param itb begin iterator of the range.
+     * @param ite end iterator of the range.
+     * @param aSegmentComputer a segment computer, used as a prototype.
+     */
+    ParallelSegmentation( const ConstIterator& itb, const ConstIterator& ite,
+                          const SegmentComputer& aSegmentComputer );
+
+    /**
+     * Sets the number of elements of a chunk (65536 by default).
+     * @param aChunkSize any positive number.
+     */
+    void setChunkSize( Size aChunkSize );
+
+    /// @return the number of elements of a chunk.
+    Size chunkSize() const;
+
+    // ----------------------- Segmentation services --------------------------
+  public:
+
+    /**
+     * @return the segments of the greedy segmentation of the range,
+     * the same ones as GreedySegmentation in mode "Truncate".
+     */
+    Segments greedySegments() const;
+
+    /**
+     * @return the maximal segments of the range, the same ones as
+     * SaturatedSegmentation in mode "MostCentered".
+     */
+    Segments maximalSegments() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// Begin iterator of the range.
+    ConstIterator myBegin;
+    /// End iterator of the range.
+    ConstIterator myEnd;
+    /// The segment computer used as a prototype.
+    SegmentComputer mySegmentComputer;
+    /// The number of elements of a chunk.
+    Size myChunkSize;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Computes a chain of segments chunk by chunk and merges the chunks.
+     *
+     * @param first the functor computing the first segment of the range.
+     * @param seed the functor computing the first segment of a chunk
+     * from its first element.
+     * @param next the functor computing the next segment of the chain.
+     * @param isLast the predicate telling if a segment is the last one.
+     * @return the chain of segments.
+     */
+    template <typename TFirst, typename TSeed, typename TNext, typename TIsLast>
+    Segments chain( const TFirst & first, const TSeed & seed,
+                    const TNext & next, const TIsLast & isLast ) const;
+
+    /**
+     * @param s any segment computer.
+     * @param t any segment computer.
+     * @return 'true' iff both segments have the same range.
+     */
+    static bool sameRange( const SegmentComputer & s, const SegmentComputer & t );
+
+  }; // end of class ParallelSegmentation
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ParallelSegmentation'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ParallelSegmentation' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSegmentComputer>
+  std::ostream&
+  operator<< ( std::ostream & out, const ParallelSegmentation<TSegmentComputer> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/ParallelSegmentation.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ParallelSegmentation_h
+
+#undef ParallelSegmentation_RECURSES
+#endif // else defined(ParallelSegmentation_RECURSES)
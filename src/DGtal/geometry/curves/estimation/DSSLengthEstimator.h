@@ -52,6 +52,7 @@
 #include "DGtal/base/Common.h"
 //#include "DGtal/base/IteratorTraits.h"
 #include "DGtal/geometry/curves/GreedySegmentation.h"
+#include "DGtal/geometry/curves/ParallelSegmentation.h"
 #include "DGtal/geometry/curves/ArithmeticalDSSComputer.h"
 
 //////////////////////////////////////////////////////////////////////////////
@@ -42,6 +42,7 @@
 // Inclusions
 #include <iostream>
 #include <list>
+#include <vector>
 
 #include "DGtal/base/Common.h"
 #include "DGtal/base/Exceptions.h"
@@ -50,6 +51,7 @@
 #include "DGtal/geometry/curves/estimation/CSegmentComputerEstimator.h"
 #include "DGtal/geometry/curves/CForwardSegmentComputer.h"
 #include "DGtal/geometry/curves/SaturatedSegmentation.h"
+#include "DGtal/geometry/curves/ParallelSegmentation.h"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -152,7 +154,10 @@ namespace DGtal
      * from itb till ite (excluded)
      *
      * NB: the whole range [@e myBegin , @e myEnd)| 
-     * is scanned in the worst case
+     * is scanned in the worst case. When the whole range is
+     * processed and is given by random access iterators or
+     * circulators, its maximal segments are computed in parallel
+     * (see ParallelSegmentation).
      */
     template <typename OutputIterator>
     OutputIterator eval(const ConstIterator& itb, const ConstIterator& ite, 
@@ -213,6 +218,23 @@ namespace DGtal
 			   SegmentIterator& first, SegmentIterator& last, 
 			   OutputIterator result, CirculatorType); 
 
+    /**
+     * Estimation for the whole (open or closed) range from its
+     * maximal segments, computed by ParallelSegmentation.
+     *
+     * @param itb begin iterator of the range
+     * @param ite end iterator of the range
+     * @param segments the maximal segments of the range
+     * @param result output iterator on the estimated quantity
+     *
+     * @return the estimated quantity
+     * from itb till ite (excluded)
+     */
+    template <typename OutputIterator>
+    OutputIterator evalFromSegments(const ConstIterator& itb, const ConstIterator& ite,
+                                    const std::vector<SegmentComputer>& segments,
+                                    OutputIterator result);
+
     // ------------------------- Hidden services ------------------------------
 
   private:
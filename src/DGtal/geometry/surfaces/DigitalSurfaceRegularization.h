@@ -43,6 +43,7 @@
 #include <iostream>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/ThreadPool.h"
 #include "DGtal/topology/DigitalSurface.h"
 
 #include "DGtal/helpers/StdDefs.h"
@@ -80,6 +81,12 @@ namespace DGtal
    * To minimize this energy, instead of solving the associated sparse linear system as described in @cite coeurjolly17regDGCI,
    * we perform a gradient descent strategy which allows us a finer control over the vertices displacement (see advection methods).
    *
+   * The energy, its gradient and the gradient norm are computed in a
+   * single pass over the pointels, run in parallel on the default
+   * ThreadPool. Each pointel gathers the alignment terms of its
+   * adjacent surfels through precomputed compressed rows, so that no
+   * two threads write to the same gradient vector.
+   *
    * @see testDigitalSurfaceRegularization.cpp
    *
    * @tparam TDigitalSurface a Digital Surface type (see DigitalSurface).
@@ -244,7 +251,8 @@ namespace DGtal
      * @param [in] dt initial learning rate
      * @param [in] epsilon minimum l_infity norm of the gradient vector
      * @param [in] advectionFunc advection function/functor/lambda to move a regularized point &a p associated with
-     * the original point @a o w.r.t to a displacement vector @a v (default = p+v)
+     * the original point @a o w.r.t to a displacement vector @a v (default = p+v). It is called
+     * concurrently on distinct points.
      * @tparam AdvectionFunction type of advection function, functor or lambda (RealPoint, RealPoint, RealVector)->RealPoint.
      * @return the energy at the final step.
      */
@@ -410,6 +418,24 @@ namespace DGtal
      * Internal init method to set up topological caches.
      */
     void cacheInit();
+
+    /**
+     * Computes the energy gradient vector, its l_infinity norm
+     * (stored in myGradientNorm) and returns the energy value, in one
+     * parallel pass over the pointels.
+     *
+     * @param alpha the data attachment coefficient of a pointel index.
+     * @param beta  the alignment coefficient of a pointel index.
+     * @param gamma the fairness coefficient of a pointel index.
+     * @tparam AlphaWeight a functor SH3::Idx -> double.
+     * @tparam BetaWeight a functor SH3::Idx -> double.
+     * @tparam GammaWeight a functor SH3::Idx -> double.
+     * @return the energy value.
+     */
+    template <typename AlphaWeight, typename BetaWeight, typename GammaWeight>
+    double computeGradient(const AlphaWeight & alpha,
+                           const BetaWeight & beta,
+                           const GammaWeight & gamma);
     
     
     // ------------------------- Private Datas --------------------------------
@@ -452,14 +478,14 @@ namespace DGtal
     
     ///Gradient of the energy w.r.t. vertex positons
     Positions myGradient;
+    ///l_infinity norm of the last computed gradient
+    double myGradientNorm;
     
     
   
     // ---------------------------------------------------------------
     ///Internal members to store precomputed topological informations
     
-    ///Gradient of the quad alignement w.r.t. vertex positons
-    Positions myGradientAlign;
     
     ///Instance of the KSpace
     SH3::KSpace myK;
@@ -479,10 +505,16 @@ namespace DGtal
     std::vector< SH3::Cell > myAlignPointels;
     ///Number of adjacent edges to pointels
     std::vector<unsigned char> myNumberAdjEdgesToPointel;
-    ///Indices of cells foor the Fairness term
-    std::vector< SH3::Idx > myFairnessPointelsIdx;
-    ///Number of adjacent faces to given vertex
-    std::vector< unsigned char > myNbAdjacent;
+    ///For each pointel, the first of its entries in myPointelSurfels
+    std::vector< std::size_t > myPointelSurfelsOffsets;
+    ///Surfels adjacent to each pointel (compressed rows)
+    std::vector< SH3::Idx > myPointelSurfels;
+    ///Next pointel around the surfel of each entry of myPointelSurfels
+    std::vector< SH3::Idx > myPointelSurfelsNext;
+    ///For each pointel, the first of its entries in myFairnessNeighbors
+    std::vector< std::size_t > myFairnessOffsets;
+    ///Adjacent pointels of each pointel for the Fairness term (compressed rows)
+    std::vector< SH3::Idx > myFairnessNeighbors;
     ///All faces of the dual digital surfacce
     SH3::PolygonalSurface::FaceRange myFaces;
     
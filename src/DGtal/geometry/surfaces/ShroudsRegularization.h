@@ -43,6 +43,7 @@
 #include <iostream>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/ThreadPool.h"
 #include "DGtal/topology/CanonicSCellEmbedder.h"
 #include "DGtal/topology/IndexedDigitalSurface.h"
 #include "DGtal/topology/DigitalSurface2DSlice.h"
@@ -64,6 +65,12 @@ namespace DGtal {
   ///
   /// @note This method is limited to \b closed digital surfaces.
   ///
+  /// @note Optimization steps and energies are computed in parallel
+  /// over the vertices on the default ThreadPool (see
+  /// ThreadPool::setDefaultNumberOfThreads). Each step updates all
+  /// parameters from the previous ones, so results do not depend on
+  /// the number of threads.
+  ///
   /// @tparam TDigitalSurfaceContainer any digital surface container
   /// (a model concepts::CDigitalSurfaceContainer), for instance a
   /// SetOfSurfels.
@@ -242,17 +249,15 @@ namespace DGtal {
     /// Computes the distances between the vertices along slices.
     void parameterize()
     {
-      Scalar d = 0.0;
-      // Vertex n = 0;
-      for ( Dimension i = 0; i < 3; ++i )
-	for ( Vertex v = 0; v < myT.size(); ++v )
-	  {
-	    if ( myNext[ i ][ v ] == myInvalid )  continue; // not a valid slice
-	    myNextD[ i ][ v ] = ( position( myNext[ i ][ v ] ) - position( v ) ).norm();
-	    myPrevD[ i ][ v ] = ( position( myPrev[ i ][ v ] ) - position( v ) ).norm();
-	    d += myNextD[ i ][ v ];
-	    //	    n += 1;
-	  }
+      ThreadPool::defaultPool().parallelFor( myT.size(), [&] ( std::size_t v, unsigned int )
+	{
+	  for ( Dimension i = 0; i < 3; ++i )
+	    {
+	      if ( myNext[ i ][ v ] == myInvalid )  continue; // not a valid slice
+	      myNextD[ i ][ v ] = ( position( myNext[ i ][ v ] ) - position( v ) ).norm();
+	      myPrevD[ i ][ v ] = ( position( myPrev[ i ][ v ] ) - position( v ) ).norm();
+	    }
+	}, 1024 );
     }
 
     /// @param v_i a pair (vertex,tangent direction)
@@ -465,6 +470,29 @@ namespace DGtal {
     /// Forces t to stay in ]0,1[
     void enforceBounds();
 
+    /// Sums a function over all vertices, by blocks processed in
+    /// parallel on the default ThreadPool.
+    ///
+    /// @param f a function Vertex -> double.
+    /// @return the sum of the values of f, independent of the number of threads.
+    template < typename VertexFunction >
+    double sumOverVertices( const VertexFunction & f ) const;
+
+    /// @param randomization the amplitude of perturbations.
+    /// @return a random perturbation of the parameter of each vertex.
+    Scalars randomPerturbations( const double randomization ) const;
+
+    /// Moves each parameter t to `wNew * newT + wOld * t` (within bounds).
+    ///
+    /// @param newT the new parameters of the vertices.
+    /// @param wNew the weight of the new parameters.
+    /// @param wOld the weight of the current parameters.
+    ///
+    /// @return the pair of \f$ l_\infty \f$ and \f$ l_2 \f$ norms of
+    /// vertex displacements.
+    std::pair<double,double> dampedUpdate( const Scalars & newT,
+					   const double wNew, const double wOld );
+
     /// @}
     
     // -------------------------- internal methods ------------------------------
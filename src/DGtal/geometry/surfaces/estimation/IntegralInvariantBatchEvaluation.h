@@ -0,0 +1,159 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file IntegralInvariantBatchEvaluation.h
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module IntegralInvariantBatchEvaluation.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(IntegralInvariantBatchEvaluation_RECURSES)
+#error Recursive header files inclusion detected in IntegralInvariantBatchEvaluation.h
+#else // defined(IntegralInvariantBatchEvaluation_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define IntegralInvariantBatchEvaluation_RECURSES
+
+#if !defined IntegralInvariantBatchEvaluation_h
+/** Prevents repeated inclusion of headers. */
+#define IntegralInvariantBatchEvaluation_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <cstddef>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ThreadPool.h"
+#include "DGtal/topology/CCellularGridSpaceND.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class IntegralInvariantBatchEvaluation
+  /**
+   * Description of template class 'IntegralInvariantBatchEvaluation' <p>
+   * \brief Aim: Services shared by the Integral Invariant estimators
+   * (IntegralInvariantVolumeEstimator and
+   * IntegralInvariantCovarianceEstimator) to evaluate a whole range
+   * of surfels at once, in parallel.
+   *
+   * The convolution of a surfel reuses the result of the previous one
+   * when their inner (resp. outer) spels are 0-adjacent: only the
+   * differences between the two positions of the kernel are visited
+   * (see DigitalSurfaceConvolver). The surfels are therefore first
+   * sorted into a traversal order (see traversalOrder()) which chains
+   * 0-adjacent inner spels and visits the space locally. This
+   * traversal is then cut into chunks of consecutive surfels that are
+   * evaluated in parallel on the default ThreadPool, each thread
+   * keeping its own convolution state. Results are given back in the
+   * order of the input surfels.
+   *
+   * Since the convolution only counts points (and sums their
+   * coordinates for moments), the results do not depend on the
+   * traversal order.
+   *
+   * @tparam TKSpace a model of CCellularGridSpaceND.
+   *
+   * @see testIntegralInvariantVolumeEstimator.cpp
+   */
+  template <typename TKSpace>
+  struct IntegralInvariantBatchEvaluation
+  {
+    typedef TKSpace KSpace;
+    BOOST_CONCEPT_ASSERT(( concepts::CCellularGridSpaceND< KSpace > ));
+    typedef typename KSpace::SCell Surfel;
+    typedef typename KSpace::Point Point;
+    typedef typename KSpace::PreCellularGridSpace KPreSpace;
+    typedef std::vector<Surfel> Surfels;
+    typedef typename Surfels::const_iterator SurfelConstIterator;
+
+    /// Number of consecutive surfels of the traversal evaluated as one
+    /// task. Each task starts with a full kernel convolution.
+    static const std::size_t chunkSize = 256;
+
+    /**
+     * Computes a traversal of the given surfels such that consecutive
+     * surfels have, as often as possible, the same or 0-adjacent inner
+     * spels. Surfels sharing an inner spel are grouped, then each
+     * chain moves to an unvisited 0-adjacent inner spel (1-adjacent
+     * ones first) while there is one. New chains start at the
+     * smallest unvisited inner spel (last coordinate first).
+     *
+     * @param surfels any surfels.
+     * @return a permutation of the indices of @a surfels.
+     */
+    static std::vector<std::size_t> traversalOrder( const Surfels & surfels );
+
+    /**
+     * Evaluates several convolutions on all the given surfels. The
+     * surfels are sorted with traversalOrder(), then chunks of
+     * consecutive surfels are processed in parallel. For each chunk
+     * and each convolution @a i, the call `evaluation( i, itb, ite,
+     * out )` must write the quantities of the surfels in `[itb,ite)`,
+     * in this order, on the output iterator `out`. The convolutions
+     * of a chunk are evaluated one after the other by the same
+     * thread, while the neighborhood of the chunk is still in cache.
+     *
+     * @tparam TQuantity the type of the computed quantities.
+     *
+     * @tparam TRangeEvaluation the type of a callable object
+     * `void( std::size_t, SurfelConstIterator, SurfelConstIterator,
+     * std::back_insert_iterator< std::vector<TQuantity> > & )`. It is called
+     * concurrently.
+     *
+     * @param[in] surfels any surfels.
+     * @param[in] nbEvaluations the number of convolutions.
+     * @param[in] evaluation the evaluation of one convolution on a range of surfels.
+     * @param[out] results for each convolution, its quantities in the order of @a surfels.
+     */
+    template <typename TQuantity, typename TRangeEvaluation>
+    static void eval( const Surfels & surfels,
+                      std::size_t nbEvaluations,
+                      const TRangeEvaluation & evaluation,
+                      std::vector< std::vector<TQuantity> > & results );
+
+    /**
+     * @param surfel any surfel.
+     * @return the Khalimsky coordinates of the spel directly incident
+     * to @a surfel, i.e. the inner spel used by the convolutions.
+     */
+    static Point innerSpel( const Surfel & surfel );
+
+  }; // end of struct IntegralInvariantBatchEvaluation
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantBatchEvaluation.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined IntegralInvariantBatchEvaluation_h
+
+#undef IntegralInvariantBatchEvaluation_RECURSES
+#endif // else defined(IntegralInvariantBatchEvaluation_RECURSES)
@@ -57,6 +57,10 @@
 
 #include "DGtal/geometry/surfaces/DigitalSurfaceConvolver.h"
 #include "DGtal/geometry/surfaces/estimation/IIGeometricFunctors.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantBatchEvaluation.h"
+#ifdef WITH_FFTW3
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantFFTEvaluation.h"
+#endif
 #include "DGtal/shapes/EuclideanShapesDecorator.h"
 
 #include "DGtal/shapes/implicit/ImplicitBall.h"
@@ -88,6 +92,13 @@ namespace DGtal
 * IntegralInvariantVolumeEstimator instead when trying to estimate the
 * 2D curvature or the mean curvature.
 *
+* Large ranges of surfels, in any order, are better given to
+* evalBatch, which sorts them into chains of 0-adjacent surfels and
+* evaluates them in parallel. It can also estimate the quantity for
+* several kernel radii in one pass. With the FFTW3 library, evalFFT
+* computes the convolutions of all surfels at once with FFTs, which is
+* faster for large kernel radii.
+*
 * @tparam TKSpace a model of CCellularGridSpaceND, the cellular space
 * in which the shape is defined.
 *
@@ -290,6 +301,103 @@ public:
                        SurfelConstIterator ite,
                        OutputIterator result ) const;
 
+  /**
+  * -- Batch estimation --
+  *
+  * Compute the integral invariant covariance matrix for a range of surfels
+  * [itb,ite) on a shape, then apply the CovarianceMatrixFunctor to extract
+  * some geometric information. Surfels are first sorted into a
+  * traversal order chaining 0-adjacent surfels, then chunks of this
+  * traversal are evaluated in parallel on the default ThreadPool
+  * (see IntegralInvariantBatchEvaluation). Results are the same as
+  * eval( itb, ite, result ) and are output in the same order.
+  *
+  * @note The point predicate is evaluated concurrently by several
+  * threads: it must support concurrent reads.
+  *
+  * @tparam OutputIterator type of Iterator of an array of Quantity
+  * @tparam SurfelConstIterator type of Iterator on a Surfel
+  *
+  * @param[in] itb iterator defining the start of the range of surfels
+  * where we wish to compute some geometric information.
+  *
+  * @param[in] ite iterator defining the end of the range of surfels
+  * where we wish to compute some geometric information.
+  *
+  * @param[in] result output iterator of results of the computation.
+  * @return the updated output iterator after all outputs.
+  */
+  template <typename OutputIterator, typename SurfelConstIterator>
+  OutputIterator evalBatch( SurfelConstIterator itb,
+                            SurfelConstIterator ite,
+                            OutputIterator result ) const;
+
+  /**
+  * -- Batch estimation for several radii --
+  *
+  * Compute the integral invariant covariance matrix for a range of surfels
+  * [itb,ite) and for several kernel radii in one pass: the kernels
+  * and their shifting masks are built once per radius, the surfels are
+  * sorted once, and each chunk of the traversal is evaluated for all
+  * radii by the same thread (see evalBatch). The CovarianceMatrixFunctor is
+  * copied and initialized for each radius. The radius given to
+  * setParams is ignored.
+  *
+  * @pre The shape must have been attached (see attach).
+  *
+  * @tparam SurfelConstIterator type of Iterator on a Surfel
+  *
+  * @param[in] _h grid size (must be >0).
+  * @param[in] radii the "digital" radii of the kernels (must be >0).
+  * @param[in] itb iterator on the first surfel of the range.
+  * @param[in] ite iterator after the last surfel of the range.
+  *
+  * @return for each radius, the quantities in the order of [itb,ite).
+  */
+  template <typename SurfelConstIterator>
+  std::vector< std::vector< Quantity > >
+  evalBatch( const double _h, const std::vector< double > & radii,
+             SurfelConstIterator itb, SurfelConstIterator ite ) const;
+
+#ifdef WITH_FFTW3
+  /**
+  * -- FFT estimation --
+  *
+  * Compute the integral invariant covariance matrix for a range of surfels
+  * [itb,ite) on a shape, then apply the CovarianceMatrixFunctor to extract
+  * some geometric information. The moments are not summed around
+  * each surfel but computed for all the points of the bounding box of
+  * the surfels, block by block, with FFT convolutions (see
+  * IntegralInvariantFFTEvaluation), then sampled at the inner and
+  * outer spels of the surfels. This is faster than evalBatch for
+  * large kernel radii. Results are the same as eval( itb, ite, result )
+  * (up to rounding errors) and are output in the same order.
+  *
+  * @note Requires the FFTW3 library (`cmake -DWITH_FFTW3=true ..`).
+  *
+  * @tparam OutputIterator type of Iterator of an array of Quantity
+  * @tparam SurfelConstIterator type of Iterator on a Surfel
+  *
+  * @param[in] itb iterator defining the start of the range of surfels
+  * where we wish to compute some geometric information.
+  *
+  * @param[in] ite iterator defining the end of the range of surfels
+  * where we wish to compute some geometric information.
+  *
+  * @param[in] result output iterator of results of the computation.
+  *
+  * @param[in] blockSize the size of the FFTs along each axis (0 for
+  * a size chosen from the kernel radius).
+  *
+  * @return the updated output iterator after all outputs.
+  */
+  template <typename OutputIterator, typename SurfelConstIterator>
+  OutputIterator evalFFT( SurfelConstIterator itb,
+                          SurfelConstIterator ite,
+                          OutputIterator result,
+                          std::size_t blockSize = 0 ) const;
+#endif
+
   /**
   * Writes/Displays the object on an output stream.
   * @param out the output stream where the object is written.
@@ -302,15 +410,32 @@ public:
   */
   bool isValid() const;
 
+  // ------------------------- Private services ------------------------------
+private:
+
+  /**
+  * Computes the digital kernel of a given radius and its shifting
+  * masks (the points of the kernel that are not in the kernel shifted
+  * by some 0-adjacent vector). The full kernel is stored at the middle
+  * position, so that convolvers walk an explicit point set instead of
+  * testing every point of the bounding box of the kernel.
+  *
+  * @param[in] gridStep the grid step.
+  * @param[in] eRadius the Euclidean radius of the kernel.
+  * @param[out] kernelsSet the kernel and the shifting masks, to be deleted by the caller.
+  * @param[out] kernels the begin/end iterators of the sets of @a kernelsSet.
+  */
+  void computeKernels( const Scalar gridStep, const Scalar eRadius,
+                       std::vector< DigitalSet * > & kernelsSet,
+                       std::vector< PairIterators > & kernels ) const;
+
   // ------------------------- Private Datas --------------------------------
 private:
 
   CovarianceMatrixFunctor myFct;            ///< The covariance matrix functor that transforms the II covariance matrix into a quantity.
   const KernelSpelFunctor myKernelFunctor;  ///< Kernel functor (on Spel)
   std::vector< PairIterators > myKernels;   ///< array of begin/end iterator of shifting masks.
-  std::vector< DigitalSet * > myKernelsSet; ///< Array of shifting masks. Size = 9 for each shifting (0-adjacent and full kernel included)
-  CountedPtr<KernelSupport>      myKernel;      ///< Euclidean kernel
-  CountedPtr<DigitalShapeKernel> myDigKernel;   ///< Digital kernel
+  std::vector< DigitalSet * > myKernelsSet; ///< Array of shifting masks. Size = 3^d for each shifting (0-adjacent and full kernel included)
   CountedConstPtrOrConstPtr<PointPredicate> myPointPredicate; ///< Smart pointer (if required) on a point predicate.
   CountedPtr<Domain>             myShapeDomain; ///< Smart pointer on domain         
   CountedPtr<ShapePointFunctor>  myShapePointFunctor; ///< Smart pointer on functor point -> {0,1}
@@ -0,0 +1,185 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file IntegralInvariantFFTEvaluation.h
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module IntegralInvariantFFTEvaluation.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(IntegralInvariantFFTEvaluation_RECURSES)
+#error Recursive header files inclusion detected in IntegralInvariantFFTEvaluation.h
+#else // defined(IntegralInvariantFFTEvaluation_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define IntegralInvariantFFTEvaluation_RECURSES
+
+#if !defined IntegralInvariantFFTEvaluation_h
+/** Prevents repeated inclusion of headers. */
+#define IntegralInvariantFFTEvaluation_h
+
+#ifndef WITH_FFTW3
+  #error You need to have activated FFTW3 (WITH_FFTW3) to include this file.
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <cstddef>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/math/linalg/SimpleMatrix.h"
+#include "DGtal/math/RealFFT.h"
+#include "DGtal/topology/CCellularGridSpaceND.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class IntegralInvariantFFTEvaluation
+  /**
+   * Description of template class 'IntegralInvariantFFTEvaluation' <p>
+   * \brief Aim: Services shared by the Integral Invariant estimators
+   * (IntegralInvariantVolumeEstimator and
+   * IntegralInvariantCovarianceEstimator) to compute their volumes
+   * and moments with Fast Fourier Transforms (see RealFFT) instead of
+   * summing the kernel around each surfel.
+   *
+   * The moments of order at most 2 of the intersection of the shape
+   * with the kernel, centered at point \f$ p \f$, are the correlations
+   * of the characteristic function \f$ \chi \f$ of the shape with the
+   * kernel weighted by monomials:
+   * \f$ m_\alpha(p) = \sum_{d \in K} \chi(p + d) d^\alpha \f$.
+   * They are computed for all the points of a box at once, as
+   * products in the frequency domain. Large boxes are cut into blocks
+   * processed one after the other with the overlap-save method: each
+   * block is extended by the radius of the kernel on every side, its
+   * circular convolution is computed with FFTs of a fixed size, and
+   * only the values that are not polluted by the wrap-around are kept.
+   * The spectra of the kernels are thus computed once for all blocks,
+   * and the memory stays bounded by a few arrays of the block size.
+   *
+   * The cost does not depend on the size of the kernel, contrary to
+   * the direct summation of DigitalSurfaceConvolver whose cost grows
+   * like \f$ r^{d-1} \f$ per surfel. FFT evaluation is therefore
+   * faster for large radii or when many points are evaluated (see
+   * testIntegralInvariantFFT-benchmark.cpp). Blocks that contain no
+   * requested point are skipped.
+   *
+   * Moments are relative to the kernel center. Since they are sums of
+   * integers, FFT results are rounded to the nearest integer and are
+   * thus exactly the ones of the direct summation.
+   *
+   * @note Requires the FFTW3 library (`cmake -DWITH_FFTW3=true ..`).
+   *
+   * @tparam TKSpace a model of CCellularGridSpaceND.
+   *
+   * @see testIntegralInvariantVolumeEstimator.cpp
+   */
+  template <typename TKSpace>
+  struct IntegralInvariantFFTEvaluation
+  {
+    typedef TKSpace KSpace;
+    BOOST_CONCEPT_ASSERT(( concepts::CCellularGridSpaceND< KSpace > ));
+    typedef typename KSpace::Space Space;
+    typedef typename KSpace::SCell Surfel;
+    typedef typename KSpace::Point Point;
+    typedef typename KSpace::PreCellularGridSpace KPreSpace;
+    typedef HyperRectDomain<Space> Domain;
+    typedef std::vector<Surfel> Surfels;
+    typedef SimpleMatrix< double, Space::dimension, Space::dimension > CovarianceMatrix;
+    typedef RealFFT< Domain, double > FFT;
+
+    /// Number of moments of order at most 2: the volume, the first
+    /// order moments \f$ m_k \f$, then the second order moments
+    /// \f$ m_{kl} \f$ with \f$ k \le l \f$, in lexicographic order.
+    static const Dimension nbMoments =
+      1 + Space::dimension + ( Space::dimension * ( Space::dimension + 1 ) ) / 2;
+
+    /**
+     * Computes the first moments of the intersection of a shape with
+     * a kernel centered at the given points.
+     *
+     * @tparam TPointPredicate a model of concepts::CPointPredicate.
+     * @tparam TKernelConstIterator a forward iterator on Point.
+     *
+     * @param[in] shape the shape.
+     * @param[in] domain the domain of the shape, points outside are not in the shape.
+     * @param[in] kb an iterator on the first point of the kernel, relative to its center.
+     * @param[in] ke an iterator after the last point of the kernel.
+     * @param[in] points the centers of the kernel.
+     * @param[in] nb the number of moments, either 1 (the volume only) or nbMoments.
+     * @param[in] blockSize the size of the blocks along each axis,
+     * including the margins of the overlap-save method. It is rounded
+     * to a size for which FFTs are fast. When 0, a size is chosen from
+     * the kernel radius.
+     *
+     * @return the moments, `nb` values per point, in the order of @a points.
+     */
+    template <typename TPointPredicate, typename TKernelConstIterator>
+    static std::vector<double>
+    moments( const TPointPredicate & shape, const Domain & domain,
+             TKernelConstIterator kb, TKernelConstIterator ke,
+             const std::vector<Point> & points,
+             Dimension nb, std::size_t blockSize = 0 );
+
+    /**
+     * @param[in] surfels any surfels.
+     * @return the digital coordinates of the inner and outer spels of
+     * @a surfels, i.e. the points where the convolutions of the Integral
+     * Invariant estimators are evaluated, the inner spel of
+     * `surfels[ i ]` being at index `2*i` and its outer spel at `2*i+1`.
+     */
+    static std::vector<Point> spels( const Surfels & surfels );
+
+    /**
+     * @param[in] m the nbMoments moments of some set.
+     * @return the covariance matrix of this set, as computed by
+     * DigitalSurfaceConvolver::computeCovarianceMatrix.
+     */
+    static CovarianceMatrix covarianceMatrix( const double * m );
+
+    /**
+     * @param[in] n any positive integer.
+     * @return the smallest integer not smaller than @a n whose prime
+     * factors are 2, 3, 5 or 7, for which FFTW is the most efficient.
+     */
+    static std::size_t fastSize( std::size_t n );
+
+  }; // end of struct IntegralInvariantFFTEvaluation
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantFFTEvaluation.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined IntegralInvariantFFTEvaluation_h
+
+#undef IntegralInvariantFFTEvaluation_RECURSES
+#endif // else defined(IntegralInvariantFFTEvaluation_RECURSES)
@@ -0,0 +1,364 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BatchedDigitalConvexity.h
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module BatchedDigitalConvexity.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BatchedDigitalConvexity_RECURSES)
+#error Recursive header files inclusion detected in BatchedDigitalConvexity.h
+#else // defined(BatchedDigitalConvexity_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BatchedDigitalConvexity_RECURSES
+
+#if !defined BatchedDigitalConvexity_h
+/** Prevents repeated inclusion of headers. */
+#define BatchedDigitalConvexity_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clone.h"
+#include "DGtal/base/ThreadPool.h"
+#include "DGtal/kernel/PointHashFunctions.h"
+#include "DGtal/geometry/volumes/DigitalConvexity.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BatchedDigitalConvexity
+  /**
+     Description of template class 'BatchedDigitalConvexity' <p>
+     \brief Aim: Answers many full convexity and full subconvexity
+     queries on digital sets, caching the results and the cell covers
+     of the sets, and evaluating batches of independent queries in
+     parallel on the default ThreadPool.
+
+     Full convexity is checked with the morphological
+     characterization `Star(X) = Star(CvxH(X))`, both stars being
+     represented as lattice sets (see LatticeSetByIntervals and
+     DigitalConvexity::isFullyConvexFast). Cell covers `Star(X)` are
+     cached with the same representation, so that full subconvexity
+     queries against the same set X only compute the star of the
+     convex hull of the query.
+
+     Caches are keyed by point sets, i.e. by the sorted range of their
+     points, and are shared by all threads. When a cache holds a given
+     number of entries, its least recently used entry is evicted. Full
+     convexity queries only fill the cache of convexities, the cache of
+     cell covers is filled by cellCover and full subconvexity queries.
+
+     @code
+     BatchedDigitalConvexity< Z3i::KSpace > bdconv( K );
+     std::vector< std::vector< Z3i::Point > > queries = ...;
+     auto fc = bdconv.isFullyConvex( queries ); // in parallel
+     auto cotangent = bdconv.isFullySubconvex( segments, X );
+     @endcode
+
+     @tparam TKSpace an arbitrary model of CCellularGridSpaceND.
+
+     @see DigitalConvexity, testBatchedDigitalConvexity.cpp,
+     testBatchedDigitalConvexity-benchmark.cpp
+   */
+  template < typename TKSpace >
+  class BatchedDigitalConvexity
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CCellularGridSpaceND< TKSpace > ));
+
+  public:
+    typedef BatchedDigitalConvexity<TKSpace>     Self;
+    typedef TKSpace                              KSpace;
+    typedef DigitalConvexity< KSpace >           Convexity;
+    typedef typename Convexity::Integer          Integer;
+    typedef typename Convexity::Point            Point;
+    typedef typename Convexity::PointRange       PointRange;
+    typedef typename Convexity::LatticeSet       LatticeSet;
+    typedef typename Convexity::Size             Size;
+    typedef std::pair< Point, Point >            Segment;
+    typedef std::shared_ptr< const LatticeSet >  CellCover;
+
+    static const Dimension dimension = KSpace::dimension;
+
+    /// Hash function of sorted point ranges.
+    struct PointRangeHash
+    {
+      std::size_t operator()( const PointRange & X ) const
+      {
+        std::size_t seed = X.size();
+        std::hash< Point > h;
+        for ( const auto & p : X ) boost::hash_combine( seed, h( p ) );
+        return seed;
+      }
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor from cellular space.
+     * @param K any cellular grid space.
+     * @param safe when 'true' performs convex hull computations with
+     * arbitrary precision integer (see DigitalConvexity).
+     * @param maxCacheSize the maximal number of entries of each cache.
+     */
+    BatchedDigitalConvexity( Clone<KSpace> K, bool safe = false,
+                             Size maxCacheSize = 1 << 20 );
+
+    BatchedDigitalConvexity( const Self & other ) = delete;
+    Self & operator=( const Self & other ) = delete;
+
+    // ----------------------- Single queries ---------------------------------
+  public:
+
+    /// @return a const reference to the digital convexity helper.
+    const Convexity & convexity() const;
+
+    /**
+     * @param X any range of \b pairwise \b distinct points.
+     * @return 'true' iff \a X is fully digitally convex.
+     *
+     * @note The cell cover of \a X is computed but not cached.
+     */
+    bool isFullyConvex( PointRange X ) const;
+
+    /**
+     * @param X any range of points.
+     * @return the cell cover `Star(X)`, as a lattice set of Khalimsky
+     * coordinates along axis 0.
+     */
+    CellCover cellCover( PointRange X ) const;
+
+    /**
+     * @param Y any range of points.
+     * @param StarX any lattice set representing an open cubical complex.
+     * @return 'true' iff \a Y is digitally fully subconvex to \a StarX.
+     */
+    bool isFullySubconvex( const PointRange & Y, const LatticeSet & StarX ) const;
+
+    // ----------------------- Batched queries --------------------------------
+  public:
+
+    /**
+     * Checks the full convexity of several sets in parallel.
+     * @param queries a range of ranges of \b pairwise \b distinct points.
+     * @return the vector whose i-th element tells if `queries[i]` is
+     * fully digitally convex.
+     */
+    std::vector< bool >
+    isFullyConvex( const std::vector< PointRange > & queries ) const;
+
+    /**
+     * Checks the full subconvexity of several sets to the set \a X
+     * in parallel.
+     * @param queries a range of ranges of points.
+     * @param X any range of points.
+     * @return the vector whose i-th element tells if `queries[i]` is
+     * digitally fully subconvex to \a X.
+     */
+    std::vector< bool >
+    isFullySubconvex( const std::vector< PointRange > & queries,
+                      const PointRange & X ) const;
+
+    /**
+     * Checks the full subconvexity (i.e. the cotangency) of several
+     * segments to the set \a X in parallel.
+     * @param segments a range of pairs of points.
+     * @param X any range of points.
+     * @return the vector whose i-th element tells if the segment
+     * `segments[i]` is digitally fully subconvex to \a X.
+     */
+    std::vector< bool >
+    isFullySubconvex( const std::vector< Segment > & segments,
+                      const PointRange & X ) const;
+
+    // ----------------------- Cache services ---------------------------------
+  public:
+
+    /// Empties the caches.
+    void clear();
+
+    /// @return the number of queries answered from the caches.
+    Size nbHits() const;
+
+    /// @return the number of queries that were computed.
+    Size nbMisses() const;
+
+    /// @return the number of entries of the cache of convexities.
+    Size nbCachedConvexities() const;
+
+    /// @return the number of entries of the cache of cell covers.
+    Size nbCachedCellCovers() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internal types -------------------------------
+  protected:
+
+    /// A cache of values keyed by sorted point ranges, that evicts its
+    /// least recently used entry when it is full. Not thread-safe.
+    template < typename TValue >
+    class LRUCache
+    {
+    public:
+      /// @param maxSize the maximal number of entries.
+      LRUCache( Size maxSize ) : myMaxSize( maxSize ) {}
+      LRUCache( const LRUCache & other ) = delete;
+      LRUCache & operator=( const LRUCache & other ) = delete;
+
+      /// @param X any sorted point range.
+      /// @return a pointer to the value associated to \a X, which
+      /// becomes the most recently used, or nullptr if there is none.
+      const TValue * find( const PointRange & X )
+      {
+        const auto it = myIndex.find( &X );
+        if ( it == myIndex.end() ) return nullptr;
+        myEntries.splice( myEntries.begin(), myEntries, it->second );
+        return &it->second->second;
+      }
+
+      /// Associates \a value to \a X, unless \a X is already cached.
+      /// @param X any sorted point range.
+      /// @param value its associated value.
+      void insert( PointRange && X, const TValue & value )
+      {
+        if ( myMaxSize == 0 || find( X ) != nullptr ) return;
+        if ( myEntries.size() >= myMaxSize )
+          {
+            myIndex.erase( &myEntries.back().first );
+            myEntries.pop_back();
+          }
+        myEntries.emplace_front( std::move( X ), value );
+        myIndex.emplace( &myEntries.front().first, myEntries.begin() );
+      }
+
+      /// @return the number of entries.
+      Size size() const
+      { return myEntries.size(); }
+
+      /// Removes all entries.
+      void clear()
+      {
+        myIndex.clear();
+        myEntries.clear();
+      }
+
+    private:
+      typedef std::list< std::pair< PointRange, TValue > > Entries;
+      /// Hashes the point range pointed to.
+      struct Hash
+      {
+        std::size_t operator()( const PointRange * X ) const
+        { return PointRangeHash()( *X ); }
+      };
+      /// Compares the point ranges pointed to.
+      struct Equal
+      {
+        bool operator()( const PointRange * X, const PointRange * Y ) const
+        { return *X == *Y; }
+      };
+      /// The maximal number of entries.
+      Size myMaxSize;
+      /// The entries, from the most to the least recently used.
+      Entries myEntries;
+      /// Finds the entry of a point range, keyed by the range stored
+      /// in the entry.
+      std::unordered_map< const PointRange *, typename Entries::iterator,
+                          Hash, Equal > myIndex;
+    };
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /// The digital convexity helper.
+    Convexity myDConv;
+    /// The maximal number of entries of each cache.
+    Size myMaxCacheSize;
+    /// Protects the caches and counters.
+    mutable std::mutex myMutex;
+    /// Full convexity of sorted point ranges.
+    mutable LRUCache< bool > myConvexities;
+    /// Cell covers of sorted point ranges.
+    mutable LRUCache< CellCover > myCellCovers;
+    /// Number of queries answered from the caches.
+    mutable Size myNbHits;
+    /// Number of queries that were computed.
+    mutable Size myNbMisses;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// Sorts \a X and removes duplicates.
+    static void normalize( PointRange & X );
+
+    /// @param X any sorted range of pairwise distinct points.
+    /// @return the cell cover `Star(X)`, without using the cache.
+    CellCover computeCellCover( const PointRange & X ) const;
+
+  }; // end of class BatchedDigitalConvexity
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'BatchedDigitalConvexity'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'BatchedDigitalConvexity' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const BatchedDigitalConvexity<TKSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "BatchedDigitalConvexity.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BatchedDigitalConvexity_h
+
+#undef BatchedDigitalConvexity_RECURSES
+#endif // else defined(BatchedDigitalConvexity_RECURSES)
@@ -44,9 +44,14 @@
 #include <vector>
 #include <string>
 #include <limits>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/Clone.h"
+#include "DGtal/base/ThreadPool.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/topology/CCellularGridSpaceND.h"
 #include "DGtal/kernel/LatticeSetByIntervals.h"
@@ -65,6 +70,13 @@ namespace DGtal
      provides services to compute all the cotangent points to a given
      point, or to compute shortest paths.
 
+     Shortest paths from many sources, distance matrices between
+     landmarks and batches of point-to-point shortest paths are
+     computed in parallel on the default ThreadPool, each thread
+     reusing its own ShortestPaths object. When the cotangent cache is
+     enabled (see useCotangentCache), the cotangent points of a point
+     computed for one source are reused by the other sources.
+
      @see moduleDigitalConvexityApplications
 
      @tparam TKSpace an arbitrary model of CCellularGridSpaceND.
@@ -84,6 +96,7 @@ namespace DGtal
     typedef std::size_t                 Index;
     typedef std::size_t                 Size;
     typedef std::vector< Index >        Path;
+    typedef std::pair< Index, Index >   IndexPair;
     typedef CellGeometry< KSpace >      CellCover;
     typedef LatticeSetByIntervals< Space > LatticeCellCover;
     
@@ -169,12 +182,16 @@ namespace DGtal
       
       /// Clears the object and prepares it for a shortest path
       /// computation.
+      ///
+      /// @note Memory is kept, so that the object may be reused for
+      /// several computations.
       void clear()
       {
         const auto nb = size();
-        myAncestor = std::vector< Index > ( nb, nb );
-        myDistance = std::vector< double >( nb, std::numeric_limits<double>::infinity() );
-        myVisited  = std::vector< bool >  ( nb, false );
+        myAncestor.assign( nb, nb );
+        myDistance.assign( nb, std::numeric_limits<double>::infinity() );
+        myVisited .assign( nb, false );
+        myUpdated.clear();
         myQ        = std::priority_queue< Node, std::vector< Node >, Comparator >();
   }
 
@@ -257,7 +274,7 @@ namespace DGtal
       ///
       /// @pre The ancestor is valid only when `isVisited(i)` is true,
       /// so after it was a `current()` node and `expand()` has been
-      /// called.
+      /// called. Otherwise it is `size()`.
       Index ancestor( Index i ) const
       {
         ASSERT( i < size() );
@@ -283,7 +300,8 @@ namespace DGtal
       /// called.
       bool isVisited( Index i ) const
       {
-        return ancestor( i ) < size();
+        ASSERT( i < size() );
+        return myVisited[ i ];
       }
 
       /// @return the infinity distance (point is not computed or unreachable)
@@ -312,7 +330,7 @@ namespace DGtal
 
       /// @return a const reference to the array storing for each
       /// point its ancestor in the shortest path, or itself if it was
-      /// a source.
+      /// a source (see ancestor).
       const std::vector< Index >& ancestors() const
       { return myAncestor; }
       
@@ -325,6 +343,11 @@ namespace DGtal
       /// point if it is already visited.
       const std::vector< bool >& visitedPoints() const
       { return myVisited; }
+
+      /// @return a const reference to the indices of the points whose
+      /// distance was decreased by the last call to 'expand()'.
+      const std::vector< Index >& lastUpdatedPoints() const
+      { return myUpdated; }
       
     protected:
       /// A pointer toward the tangency computer.
@@ -337,7 +360,7 @@ namespace DGtal
       /// may be missed.
       double                  mySecure;
       /// Stores for each point its ancestor in the shortest path, or
-      /// itself if it was a source.
+      /// itself if it was a source, or size() if it is not visited.
       std::vector< Index >    myAncestor;
       /// Stores for each point its distance to the closest source.
       std::vector< double >   myDistance;
@@ -345,6 +368,11 @@ namespace DGtal
       std::vector< bool >     myVisited;
       /// The queue of points being currently processed.
       std::priority_queue< Node, std::vector< Node >, Comparator > myQ;
+      /// The points whose distance was decreased by the last expansion.
+      std::vector< Index >    myUpdated;
+      /// The cotangent points computed by the last call to
+      /// 'getCotangentPoints' when the cache is not used.
+      std::vector< Index >    myCotangentPoints;
 
     protected:
 
@@ -359,9 +387,11 @@ namespace DGtal
       ///
       /// @param[in] i the index of a point
       ///
-      /// @return the indices of the other points of the shape that are cotangent to \a a.
-      std::vector< Index >
-      getCotangentPoints( Index i ) const;
+      /// @return a const reference to the indices of the other points
+      /// of the shape that are cotangent to \a a, valid until the next
+      /// call.
+      const std::vector< Index >&
+      getCotangentPoints( Index i );
 
     };
 
@@ -503,6 +533,40 @@ namespace DGtal
     std::vector< Index >
     getCotangentPoints( const Point& a,
                         const std::vector< bool > & to_avoid ) const;
+
+    /// Enables or disables the cache of cotangent points. When
+    /// enabled, shortest path computations use all the cotangent
+    /// points of each point (see getCotangentPoints), which are
+    /// computed once and shared by all computations, including
+    /// concurrent ones. Disabling it frees the cache.
+    ///
+    /// @param[in] enabled when 'true' the cache is used.
+    ///
+    /// @note The cached sets are the full sets of cotangent points,
+    /// whereas without cache ShortestPaths prunes the cotangent points
+    /// that are further than already visited points (see the \a
+    /// secure parameter of makeShortestPaths). Computed distances are
+    /// the same as long as \a secure is at least \f$ \sqrt{d} \f$
+    /// (the default), but among several shortest paths of equal
+    /// length, another one may be returned. With a smaller \a secure,
+    /// the cached computation may find shorter paths.
+    ///
+    /// @note Memory grows with the number of cotangent pairs, which
+    /// may be large on big sets.
+    void useCotangentCache( bool enabled );
+
+    /// @return 'true' iff the cache of cotangent points is used.
+    bool isCotangentCacheUsed() const
+    { return myUseCotangentCache; }
+
+    /// @param[in] i any valid point index.
+    ///
+    /// @return the indices of the other points of the shape that are
+    /// cotangent to point \a i, computed at the first call then
+    /// cached.
+    ///
+    /// @pre `isCotangentCacheUsed()` is true. May be called concurrently.
+    const std::vector< Index > & cachedCotangentPoints( Index i ) const;
     
     /// @}
     
@@ -589,6 +653,45 @@ namespace DGtal
     shortestPath( Index source, Index target,
                   double secure = sqrt( KSpace::dimension ),
                   bool verbose = false ) const;
+
+    /// Computes in parallel the shortest paths from each given source
+    /// to all the points.
+    ///
+    /// @param[in] sources the indices of the `n` source points.
+    /// @param secure the pruning value (see makeShortestPaths).
+    ///
+    /// @return the `n` finished ShortestPaths objects, the i-th one
+    /// giving the distances and paths to `sources[i]`.
+    std::vector< ShortestPaths >
+    computeShortestPaths( const std::vector< Index >& sources,
+                          double secure = sqrt( KSpace::dimension ) ) const;
+
+    /// Computes in parallel the geodesic distances between the given
+    /// landmarks. Each traversal stops when all landmarks are reached.
+    ///
+    /// @param[in] landmarks the indices of the `n` landmark points.
+    /// @param secure the pruning value (see makeShortestPaths).
+    ///
+    /// @return the `n x n` matrix whose element `(i,j)` is the
+    /// distance from `landmarks[i]` to `landmarks[j]`, or infinity if
+    /// they are not connected.
+    std::vector< std::vector< double > >
+    distanceMatrix( const std::vector< Index >& landmarks,
+                    double secure = sqrt( KSpace::dimension ) ) const;
+
+    /// Computes in parallel the shortest paths between pairs of
+    /// points with bidirectional searches: the traversals from both
+    /// ends stop as soon as the sum of their current distances
+    /// exceeds the length of the best path found.
+    ///
+    /// @param[in] queries the pairs `(source,target)` of point indices.
+    /// @param secure the pruning value (see makeShortestPaths).
+    ///
+    /// @return for each query, the sequence of point indices from its
+    /// source to its target, or an empty path if there is none.
+    std::vector< Path >
+    shortestPaths( const std::vector< IndexPair >& queries,
+                   double secure = sqrt( KSpace::dimension ) ) const;
     
     /// @}
     
@@ -617,6 +720,19 @@ namespace DGtal
     
     /// A map giving for each point its index.
     std::unordered_map< Point, Index > myPt2Index;
+    /// An entry of the cache of cotangent points, filled once.
+    struct CotangentCacheEntry
+    {
+      /// Ensures the points are computed by one thread only.
+      std::once_flag       computed;
+      /// The cotangent points, valid once \a computed is set.
+      std::vector< Index > points;
+    };
+    /// Tells if the cache of cotangent points is used.
+    bool myUseCotangentCache = false;
+    /// For each point, its entry in the cache of cotangent points
+    /// (shared by copies of this object, which have the same points).
+    std::shared_ptr< std::vector< CotangentCacheEntry > > myCotangentCache;
     
     // ------------------------- Private Datas --------------------------------
   private:
@@ -627,6 +743,17 @@ namespace DGtal
 
     /// Precomputes some neighborhood tables at construction.
     void setUp();
+
+    /// Computes a shortest path from \a source to \a target with a
+    /// bidirectional search.
+    ///
+    /// @param[in] source the index of the source point.
+    /// @param[in] target the index of the target point.
+    /// @param[in,out] SP0 a ShortestPaths object used from the source.
+    /// @param[in,out] SP1 a ShortestPaths object used from the target.
+    /// @return the path from \a source to \a target, or an empty path.
+    Path bidirectionalShortestPath( Index source, Index target,
+                                    ShortestPaths& SP0, ShortestPaths& SP1 ) const;
     
   }; // end of class TangencyComputer
 
@@ -0,0 +1,437 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file IndexedFMM.h
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module IndexedFMM.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(IndexedFMM_RECURSES)
+#error Recursive header files inclusion detected in IndexedFMM.h
+#else // defined(IndexedFMM_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define IndexedFMM_RECURSES
+
+#if !defined IndexedFMM_h
+/** Prevents repeated inclusion of headers. */
+#define IndexedFMM_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <limits>
+#include <utility>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageHelper.h"
+#include "DGtal/kernel/sets/CDigitalSet.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/kernel/CPointFunctor.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/Linearizer.h"
+#include "DGtal/geometry/volumes/distance/FMM.h"
+#include "DGtal/geometry/volumes/distance/FMMPointFunctors.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class IndexedFMM
+  /**
+   * Description of template class 'IndexedFMM' <p>
+   * \brief Aim: Fast Marching Method (FMM) for nd distance transforms
+   * within the domain of an image defined on a HyperRectDomain,
+   * using flat arrays indexed by the linearized points of the domain.
+   *
+   * It computes the same distance values as FMM, with the same
+   * interface, initialization functions and point functors (see
+   * FMMPointFunctors.h), but:
+   * - the state of each point of the domain (far, candidate, accepted
+   *   or outside the computation domain) is stored in a flat array,
+   *   so that the accepted point set is never searched to know if a
+   *   point is accepted, and the point predicate is evaluated once per
+   *   point;
+   * - candidates are stored once in a binary heap of linearized
+   *   indices ordered by absolute tentative distance, whose position
+   *   in the heap is stored in a flat array, so that a candidate
+   *   whose distance decreases is moved up in the heap instead of
+   *   being inserted again.
+   *
+   * In narrow band mode (see setNarrowBand), accepted points whose
+   * neighbors are all accepted or outside the computation domain are
+   * removed from the set of accepted points: their distance is kept
+   * in the image, but the set only contains the band of accepted
+   * points that the point functor may read. The set must then be
+   * independent from the image (e.g. not a DigitalSetFromMap of the
+   * image).
+   *
+   * Point predicates are only evaluated at points of the image
+   * domain, which bounds the computation.
+   *
+   * @tparam TImage  any model of CImage, whose domain is a HyperRectDomain
+   * @tparam TSet  any model of CDigitalSet
+   * @tparam TPointPredicate  any model of concepts::CPointPredicate,
+   * used to bound the computation within a domain
+   * @tparam TPointFunctor  any model of CPointFunctor,
+   * used to compute the new distance value
+   *
+   * @code
+   * typedef ImageContainerBySTLVector< Domain, double > Image;
+   * typedef DigitalSetBySTLSet< Domain > Set;
+   * typedef IndexedFMM< Image, Set, DomainPredicate< Domain > > FMM;
+   * Image image( domain );
+   * Set set( domain );
+   * FMM::initFromPointsRange( points.begin(), points.end(), image, set, 0.0 );
+   * FMM fmm( image, set, domainPredicate );
+   * fmm.compute();
+   * @endcode
+   *
+   * @see FMM, testFMM.cpp
+   */
+  template <typename TImage, typename TSet, typename TPointPredicate,
+            typename TPointFunctor = L2FirstOrderLocalDistance<TImage,TSet> >
+  class IndexedFMM
+  {
+
+    // ----------------------- Types ------------------------------
+  public:
+
+    BOOST_CONCEPT_ASSERT(( concepts::CImage<TImage> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CDigitalSet<TSet> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CPointPredicate<TPointPredicate> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CPointFunctor<TPointFunctor> ));
+
+    typedef TImage Image;
+    typedef TSet AcceptedPointSet;
+    typedef TPointPredicate PointPredicate;
+    typedef typename Image::Domain Domain;
+    typedef typename Image::Point Point;
+    BOOST_STATIC_ASSERT(( boost::is_same< Domain, HyperRectDomain< typename Domain::Space > >::value ));
+    BOOST_STATIC_ASSERT(( boost::is_same< Point, typename AcceptedPointSet::Point >::value ));
+    BOOST_STATIC_ASSERT(( boost::is_same< Point, typename PointPredicate::Point >::value ));
+
+    typedef typename Point::Dimension Dimension;
+    static const Dimension dimension = Point::dimension;
+
+    typedef TPointFunctor PointFunctor;
+    typedef typename PointFunctor::Value Value;
+    typedef DGtal::uint64_t Area;
+    typedef std::size_t Index;
+
+  private:
+
+    /// The FMM class providing the initialization functions.
+    typedef FMM<TImage, TSet, TPointPredicate, TPointFunctor> InitFMM;
+    /// Row-major order, so that the order of the indices is the
+    /// lexicographic order of the points.
+    typedef Linearizer<Domain, RowMajorStorage> Linearization;
+    /// Candidate of the heap: tentative value and linearized index.
+    typedef std::pair<Value, Index> Candidate;
+
+    /// States of the points of the domain: Unknown points have not
+    /// been tested against the point predicate yet, Retired points
+    /// are accepted points removed from the set in narrow band mode.
+    enum State : unsigned char { Unknown = 0, Far, Front, Outside, Accepted, Retired };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param aImg the distance image, defined on a HyperRectDomain.
+     * @param aSet the set of accepted points, whose distance is known.
+     * @param aPointPredicate the predicate bounding the computation.
+     */
+    IndexedFMM( Image& aImg, AcceptedPointSet& aSet,
+                ConstAlias<PointPredicate> aPointPredicate );
+
+    /**
+     * Constructor.
+     * @param aImg the distance image, defined on a HyperRectDomain.
+     * @param aSet the set of accepted points, whose distance is known.
+     * @param aPointPredicate the predicate bounding the computation.
+     * @param aAreaThreshold the number of accepted points above which the propagation stops.
+     * @param aValueThreshold the distance above which the propagation stops.
+     */
+    IndexedFMM( Image& aImg, AcceptedPointSet& aSet,
+                ConstAlias<PointPredicate> aPointPredicate,
+                const Area& aAreaThreshold, const Value& aValueThreshold );
+
+    /**
+     * Constructor.
+     * @param aImg the distance image, defined on a HyperRectDomain.
+     * @param aSet the set of accepted points, whose distance is known.
+     * @param aPointPredicate the predicate bounding the computation.
+     * @param aPointFunctor the point functor computing tentative distances.
+     */
+    IndexedFMM( Image& aImg, AcceptedPointSet& aSet,
+                ConstAlias<PointPredicate> aPointPredicate,
+                PointFunctor& aPointFunctor );
+
+    /**
+     * Constructor.
+     * @param aImg the distance image, defined on a HyperRectDomain.
+     * @param aSet the set of accepted points, whose distance is known.
+     * @param aPointPredicate the predicate bounding the computation.
+     * @param aAreaThreshold the number of accepted points above which the propagation stops.
+     * @param aValueThreshold the distance above which the propagation stops.
+     * @param aPointFunctor the point functor computing tentative distances.
+     */
+    IndexedFMM( Image& aImg, AcceptedPointSet& aSet,
+                ConstAlias<PointPredicate> aPointPredicate,
+                const Area& aAreaThreshold, const Value& aValueThreshold,
+                PointFunctor& aPointFunctor );
+
+    /**
+     * Destructor.
+     */
+    ~IndexedFMM();
+
+    IndexedFMM ( const IndexedFMM & other ) = delete;
+    IndexedFMM & operator= ( const IndexedFMM & other ) = delete;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Enables or disables the narrow band mode. When enabled, an
+     * accepted point is removed from the set of accepted points as
+     * soon as the points at distance at most @a aWidth along the axes
+     * are all accepted or outside the computation domain, since the
+     * point functor cannot read it anymore.
+     *
+     * @param aFlag 'true' to enable the narrow band mode.
+     * @param aWidth the radius of the stencil of the point functor,
+     * i.e. 1 for first order functors and 2 for L2SecondOrderLocalDistance.
+     */
+    void setNarrowBand( bool aFlag, Dimension aWidth = 1 );
+
+    /// @return 'true' iff the narrow band mode is enabled.
+    bool isNarrowBand() const;
+
+    /**
+     * Computation of the signed distance function by marching out
+     * from the initial set of accepted points.
+     *
+     * @see computeOneStep
+     */
+    void compute();
+
+    /**
+     * Accepts the candidate of min absolute distance if it is
+     * possible and then updates its neighbors.
+     *
+     * @param aPoint inserted point (if inserted)
+     * @param aValue its distance value (if inserted)
+     *
+     * @return 'true' if the point of min distance is accepted
+     * 'false' otherwise.
+     */
+    bool computeOneStep( Point& aPoint, Value& aValue );
+
+    /// @return the minimal distance value of the accepted points.
+    Value min() const;
+
+    /// @return the maximal distance value of the accepted points.
+    Value max() const;
+
+    /// @return the number of accepted points, including the retired ones.
+    Area nbAcceptedPoints() const;
+
+    /// @return the number of candidate points.
+    Index nbCandidatePoints() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- static functions for init --------------------
+
+    /// Same as FMM::initFromPointsRange.
+    template <typename TIteratorOnPoints>
+    static void initFromPointsRange( const TIteratorOnPoints& itb, const TIteratorOnPoints& ite,
+                                     Image& aImg, AcceptedPointSet& aSet,
+                                     const Value& aValue )
+    {
+      InitFMM::initFromPointsRange( itb, ite, aImg, aSet, aValue );
+    }
+
+    /// Same as FMM::initFromBelsRange.
+    template <typename KSpace, typename TIteratorOnBels>
+    static void initFromBelsRange( const KSpace& aK,
+                                   const TIteratorOnBels& itb, const TIteratorOnBels& ite,
+                                   Image& aImg, AcceptedPointSet& aSet,
+                                   const Value& aValue, bool aFlagIsPositive = true )
+    {
+      InitFMM::initFromBelsRange( aK, itb, ite, aImg, aSet, aValue, aFlagIsPositive );
+    }
+
+    /// Same as FMM::initFromBelsRange.
+    template <typename KSpace, typename TIteratorOnBels, typename TImplicitFunction>
+    static void initFromBelsRange( const KSpace& aK,
+                                   const TIteratorOnBels& itb, const TIteratorOnBels& ite,
+                                   const TImplicitFunction& aF,
+                                   Image& aImg, AcceptedPointSet& aSet,
+                                   bool aFlagIsPositive = true )
+    {
+      InitFMM::initFromBelsRange( aK, itb, ite, aF, aImg, aSet, aFlagIsPositive );
+    }
+
+    /// Same as FMM::initFromIncidentPointsRange.
+    template <typename TIteratorOnPairs>
+    static void initFromIncidentPointsRange( const TIteratorOnPairs& itb, const TIteratorOnPairs& ite,
+                                             Image& aImg, AcceptedPointSet& aSet,
+                                             const Value& aValue, bool aFlagIsPositive = true )
+    {
+      InitFMM::initFromIncidentPointsRange( itb, ite, aImg, aSet, aValue, aFlagIsPositive );
+    }
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// Initializes the states and the heap of candidates.
+    void init();
+
+    /// @return the state of point @a aPoint of index @a anIndex,
+    /// evaluating the point predicate if not done yet.
+    State state( const Point& aPoint, Index anIndex );
+
+    /// @return 'true' iff the point @a aPoint translated by @a aShift
+    /// along axis @a k lies in the domain.
+    bool isInDomain( const Point& aPoint, Dimension k,
+                     typename Point::Coordinate aShift ) const;
+
+    /**
+     * Computes the tentative distance of the neighbors of @a aPoint
+     * that are in the computation domain and not accepted.
+     * @param aPoint any accepted point.
+     * @param anIndex its index.
+     */
+    void update( const Point& aPoint, Index anIndex );
+
+    /**
+     * Computes the tentative distance of @a aPoint and inserts it in
+     * the heap, or moves it up if its distance decreased.
+     * @param aPoint any point of the computation domain, not accepted.
+     * @param anIndex its index.
+     */
+    void addNewCandidate( const Point& aPoint, Index anIndex );
+
+    /// @return 'true' iff the points at distance at most the band
+    /// width of @a aPoint along the axes are all accepted or outside
+    /// the computation domain.
+    bool isInterior( const Point& aPoint, Index anIndex );
+
+    /// Removes from the accepted point set the accepted points at
+    /// distance at most the band width of @a aPoint along the axes
+    /// (including @a aPoint) that are interior.
+    void retireAround( const Point& aPoint, Index anIndex );
+
+    /// @return 'true' iff the candidate @a a is closer than @a b.
+    static bool closer( const Candidate& a, const Candidate& b );
+    /// Moves up the candidate at position @a aPos in the heap.
+    void siftUp( Index aPos );
+    /// Moves down the candidate at position @a aPos in the heap.
+    void siftDown( Index aPos );
+    /// Puts @a aCandidate at position @a aPos in the heap.
+    void place( const Candidate& aCandidate, Index aPos );
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Reference on the image.
+    Image& myImage;
+    /// Reference on the set of accepted points.
+    AcceptedPointSet& myAcceptedPoints;
+    /// Pointer on the point functor.
+    PointFunctor* myPointFunctorPtr;
+    /// 'true' if @a myPointFunctorPtr is an owning pointer.
+    const bool myFlagIsOwning;
+    /// Point predicate bounding the computation.
+    const PointPredicate& myPointPredicate;
+    /// Area threshold (in number of accepted points).
+    Area myAreaThreshold;
+    /// Value threshold above which the propagation stops.
+    Value myValueThreshold;
+    /// Min value.
+    Value myMinValue;
+    /// Max value.
+    Value myMaxValue;
+    /// The domain of the image.
+    Domain myDomain;
+    /// The extent of the domain.
+    Point myExtent;
+    /// Offsets between the indices of neighbors along each axis.
+    Index myStrides[ dimension ];
+    /// State of each point of the domain.
+    std::vector<unsigned char> myStates;
+    /// Binary heap of candidates.
+    std::vector<Candidate> myHeap;
+    /// Position in the heap of each candidate point of the domain.
+    std::vector<Index> myHeapPositions;
+    /// Number of accepted points.
+    Area myNbAccepted;
+    /// 'true' in narrow band mode.
+    bool myNarrowBand;
+    /// Width of the narrow band.
+    Dimension myBandWidth;
+
+  }; // end of class IndexedFMM
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'IndexedFMM'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'IndexedFMM' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImage, typename TSet, typename TPointPredicate, typename TPointFunctor >
+  std::ostream&
+  operator<< ( std::ostream & out, const IndexedFMM<TImage, TSet, TPointPredicate, TPointFunctor> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/IndexedFMM.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined IndexedFMM_h
+
+#undef IndexedFMM_RECURSES
+#endif // else defined(IndexedFMM_RECURSES)
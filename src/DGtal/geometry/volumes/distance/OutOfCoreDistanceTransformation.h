@@ -0,0 +1,373 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file OutOfCoreDistanceTransformation.h
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module OutOfCoreDistanceTransformation.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testOutOfCoreDistanceTransformation.cpp
+ */
+
+#if defined(OutOfCoreDistanceTransformation_RECURSES)
+#error Recursive header files inclusion detected in OutOfCoreDistanceTransformation.h
+#else // defined(OutOfCoreDistanceTransformation_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define OutOfCoreDistanceTransformation_RECURSES
+
+#if !defined OutOfCoreDistanceTransformation_h
+/** Prevents repeated inclusion of headers. */
+#define OutOfCoreDistanceTransformation_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <array>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/ThreadPool.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/geometry/volumes/distance/CSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/VoronoiMap.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class OutOfCoreDistanceTransformation
+  /**
+   * Description of template class 'OutOfCoreDistanceTransformation' <p>
+   * \brief Aim: Out-of-core computation of the Voronoi map and of
+   * the distance transformation of domains which do not fit in memory.
+   *
+   * The algorithm is the separable one of VoronoiMap (non-periodic
+   * case), organized so that only a bounded part of the domain is in
+   * memory at any time:
+   *
+   * - pass 1: the domain is read slab by slab (a slab being the set
+   *   of points sharing the same last coordinate). The 1D steps along
+   *   dimensions @f$ 0, \ldots, d-2 @f$ are computed on batches of
+   *   slabs and the intermediate Voronoi sites are spilled to a
+   *   temporary file (in the system temporary directory, unless
+   *   another directory is given);
+   * - pass 2: the domain is cut along dimension @f$ d-2 @f$ into
+   *   blocks spanning the whole last dimension. Each block is read
+   *   back from the spill file (one contiguous read per slab), the 1D
+   *   steps along the last dimension are computed, and the final
+   *   sites are handed to the caller block by block.
+   *
+   * The batch and block sizes are chosen so that the intermediate
+   * buffers, including the site stacks of the threads, never exceed
+   * the memory bound given by the user (unless a single slab, or a
+   * single block of thickness one, already exceeds it). 1D steps are run in parallel with the default ThreadPool.
+   * The point predicate is only evaluated sequentially, in the domain
+   * order: it can thus be built on a TiledImage whose ImageCache
+   * holds a few tiles only. Similarly, results are written
+   * sequentially, block by block, and can be stored in a TiledImage
+   * with a write policy.
+   *
+   * The number of bytes read and written to the spill file, and the
+   * time spent, are recorded for each pass (see statistics()).
+   *
+   * @code
+   * typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> L2Metric;
+   * typedef functors::SimpleThresholdForegroundPredicate<MyTiledImage> Predicate;
+   * Predicate predicate( tiledInput, 0 );
+   * OutOfCoreDistanceTransformation<Z3i::Space, Predicate, L2Metric>
+   *   dt( domain, predicate, l2, 512 * 1024 * 1024 ); // 512 MiB
+   * dt.computeDistanceMap( tiledOutput );
+   * for ( auto const & s : dt.statistics() )
+   *   trace.info() << s.name << " " << s.bytesRead << " " << s.bytesWritten << std::endl;
+   * @endcode
+   *
+   * @tparam TSpace type of Digital Space (model of concepts::CSpace),
+   * of dimension at least 2.
+   * @tparam TPointPredicate point predicate returning true for points
+   * from which we compute the distance (model of concepts::CPointPredicate)
+   * @tparam TSeparableMetric a model of concepts::CSeparableMetric
+   *
+   * @see VoronoiMap, DistanceTransformation
+   */
+  template < typename TSpace,
+             typename TPointPredicate,
+             typename TSeparableMetric >
+  class OutOfCoreDistanceTransformation
+  {
+  public:
+    BOOST_CONCEPT_ASSERT(( concepts::CSpace< TSpace > ));
+    BOOST_CONCEPT_ASSERT(( concepts::CPointPredicate<TPointPredicate> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CSeparableMetric<TSeparableMetric> ));
+    BOOST_STATIC_ASSERT(( TSpace::dimension >= 2 ));
+
+    ///Both Space points and PointPredicate points must be the same.
+    BOOST_STATIC_ASSERT ((boost::is_same< typename TSpace::Point,
+                          typename TPointPredicate::Point >::value ));
+
+    typedef TSpace Space;
+    typedef TPointPredicate PointPredicate;
+    typedef TSeparableMetric SeparableMetric;
+    typedef HyperRectDomain<Space> Domain;
+    typedef typename Space::Vector Vector;
+    typedef typename Space::Point Point;
+    typedef typename Space::Dimension Dimension;
+    typedef typename Space::Point::Coordinate Abscissa;
+    typedef typename SeparableMetric::Value Value;
+
+    ///Sites are spilled as raw coordinates.
+    BOOST_STATIC_ASSERT(( sizeof( Point ) == Space::dimension * sizeof( Abscissa ) ));
+
+    /// I/O and timing report of one pass.
+    struct PassStatistics
+    {
+      /// Name of the pass.
+      std::string name;
+      /// Number of bytes read from the spill file.
+      std::size_t bytesRead;
+      /// Number of bytes written to the spill file.
+      std::size_t bytesWritten;
+      /// Number of in-memory chunks (slab batches or blocks).
+      std::size_t nbChunks;
+      /// Wall-clock time of the pass (in ms).
+      double time;
+    };
+
+    /**
+     * Constructor. No computation is done until computeVoronoiMap() or
+     * computeDistanceMap() is called.
+     *
+     * @param aDomain the (hyper-rectangular) domain on which the
+     * computation is performed.
+     * @param aPredicate the point predicate (sites are the points for
+     * which the predicate is false).
+     * @param aMetric the separable metric.
+     * @param aMaxMemory the bound (in bytes) on the size of the
+     * in-memory buffers.
+     * @param aSpillDirectory directory where the temporary spill file
+     * is created (the system temporary directory if empty).
+     */
+    OutOfCoreDistanceTransformation( ConstAlias<Domain> aDomain,
+                                     ConstAlias<PointPredicate> aPredicate,
+                                     ConstAlias<SeparableMetric> aMetric,
+                                     std::size_t aMaxMemory = std::size_t( 1 ) << 30,
+                                     const std::string & aSpillDirectory = "" );
+
+    /**
+     * Default destructor
+     */
+    ~OutOfCoreDistanceTransformation() = default;
+
+    OutOfCoreDistanceTransformation() = delete;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Sets the bound on the size of the in-memory buffers.
+     * @param aMaxMemory the bound in bytes.
+     */
+    void setMaxMemory( std::size_t aMaxMemory );
+
+    /**
+     * @return the bound on the size of the in-memory buffers.
+     */
+    std::size_t maxMemory() const;
+
+    /**
+     * Computes the Voronoi map and calls `f( p, site )` for each point
+     * @a p of the domain, @a site being its closest site (or a point
+     * with maximal coordinates if there is no site). Calls are
+     * sequential and grouped by blocks, each block being scanned in
+     * the domain order.
+     *
+     * @tparam TSiteFunctor a callable type `void( const Point &, const Point & )`.
+     * @param f the functor receiving the sites.
+     */
+    template <typename TSiteFunctor>
+    void computeVoronoiMap( TSiteFunctor && f );
+
+    /**
+     * Computes the distance transformation and stores it in an output
+     * image (e.g. a TiledImage, or any image whose domain contains the
+     * computation domain).
+     *
+     * @tparam TImage a model of concepts::CImage with values
+     * constructible from the metric values.
+     * @param output the output image.
+     */
+    template <typename TImage>
+    void computeDistanceMap( TImage & output );
+
+    /**
+     * @return the statistics of the passes of the last computation.
+     */
+    const std::vector<PassStatistics> & statistics() const;
+
+    /**
+     * @return the peak size (in bytes) of the in-memory buffers
+     * during the last computation, site stacks of the threads included.
+     */
+    std::size_t peakMemory() const;
+
+    /**
+     * @return the domain.
+     */
+    const Domain & domain() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private services ----------------------------
+  private:
+
+    /// A box of the domain stored in a buffer: lower point, extent
+    /// and strides of each dimension in the buffer.
+    struct Box
+    {
+      Point lower;
+      std::array<std::size_t, Space::dimension> extent;
+      std::array<std::size_t, Space::dimension> stride;
+    };
+
+    /**
+     * Pass 1: initialization and 1D steps along dimensions 0..d-2,
+     * slab batch by slab batch, spilled to @a spill.
+     * @param spill the spill file.
+     */
+    void computeSlabs( std::fstream & spill );
+
+    /**
+     * Pass 2: 1D steps along the last dimension, block by block.
+     * @param spill the spill file.
+     * @param f the functor receiving the final sites.
+     */
+    template <typename TSiteFunctor>
+    void computeBlocks( std::fstream & spill, TSiteFunctor & f );
+
+    /**
+     * Runs in parallel the 1D steps along dimension @a dim of all
+     * the lines of a box stored in a buffer.
+     *
+     * @param buffer the buffer.
+     * @param box the box.
+     * @param dim the dimension of the 1D steps.
+     * @return the size (in bytes) of the site stacks of the threads.
+     */
+    std::size_t computeLines( std::vector<Point> & buffer, const Box & box,
+                       const Dimension dim ) const;
+
+    /**
+     * Given a map valid at dimension @a dim-1, updates the map to make
+     * it consistent at dimension @a dim along one line of a buffer
+     * (see detail::voronoiStep1D, shared with VoronoiMap).
+     *
+     * @param line pointer to the first site of the line.
+     * @param stride offset between consecutive sites of the line.
+     * @param startingPoint the first point of the line.
+     * @param length the number of points of the line.
+     * @param dim the dimension of the update.
+     * @param sites scratch buffer for the site stack.
+     */
+    void computeStep1D( Point * line, const std::size_t stride,
+                        const Point & startingPoint, const std::size_t length,
+                        const Dimension dim, std::vector<Point> & sites ) const;
+
+    /// @return the memory bound minus the size of the site stacks of
+    /// the threads, i.e. the size available for the buffers.
+    std::size_t availableMemory() const;
+
+    /// Records the size of the in-memory buffers.
+    void recordMemory( std::size_t bytes );
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    ///Pointer to the computation domain
+    const Domain * myDomainPtr;
+
+    ///Pointer to the point predicate
+    const PointPredicate * myPointPredicatePtr;
+
+    ///Pointer to the separable metric instance
+    const SeparableMetric * myMetricPtr;
+
+    ///Bound on the in-memory buffers (in bytes)
+    std::size_t myMaxMemory;
+
+    ///Directory of the spill file
+    std::string mySpillDirectory;
+
+    ///Value to act as a +infinity value
+    Point myInfinity;
+
+    ///Domain extent along each dimension
+    std::array<std::size_t, Space::dimension> myExtent;
+
+    ///Offsets of unit steps along each dimension (domain order)
+    std::array<std::size_t, Space::dimension> myStride;
+
+    ///Statistics of the last computation
+    std::vector<PassStatistics> myStatistics;
+
+    ///Peak buffer size of the last computation
+    std::size_t myPeakMemory;
+
+  }; // end of class OutOfCoreDistanceTransformation
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'OutOfCoreDistanceTransformation'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'OutOfCoreDistanceTransformation' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename S, typename P, typename Sep>
+  std::ostream&
+  operator<< ( std::ostream & out, const OutOfCoreDistanceTransformation<S,P,Sep> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/OutOfCoreDistanceTransformation.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined OutOfCoreDistanceTransformation_h
+
+#undef OutOfCoreDistanceTransformation_RECURSES
+#endif // else defined(OutOfCoreDistanceTransformation_RECURSES)
@@ -48,6 +48,7 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CountedPtr.h"
 #include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/ThreadPool.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/images/CConstImage.h"
@@ -84,6 +85,14 @@ namespace DGtal
    * power distance between \c A and \c B is equal to their power distance
    * considering the periodicity.
    *
+   * As for VoronoiMap, the computation is sequential by default, and
+   * done in parallel if a ThreadPool is given to the constructor: the
+   * initialization and the steps along the first @f$ d-1@f$ dimensions
+   * are pipelined slab by slab, and each thread reuses its own site
+   * stacks. The weight image and the image container must then support
+   * concurrent reads (and concurrent writes at distinct points for the
+   * latter).
+   *
    * If the separable metric has a complexity of O(h) for its
    * "hiddenByPower" predicate, the overall Power map construction
    * algorithm is in @f$ O(h.d.n^d)@f$ for @f$ n^d@f$ domains (see
@@ -180,10 +189,14 @@ namespace DGtal
      * returning the weight for some points
      * @param aMetric a power
      * seprable metric instance.
+     * @param aPool the thread pool running the computation in parallel
+     * (e.g. &ThreadPool::defaultPool()), or nullptr (default) for a
+     * sequential computation.
      */
     PowerMap(ConstAlias<Domain> aDomain,
              ConstAlias<WeightImage> aWeightImage,
-             ConstAlias<PowerSeparableMetric> aMetric);
+             ConstAlias<PowerSeparableMetric> aMetric,
+             ThreadPool* aPool = nullptr);
 
     /**
      * Constructor with periodicity specification.
@@ -205,11 +218,15 @@ namespace DGtal
      * @param aPeriodicitySpec an array of size equal to the space dimension
      *        where the i-th value is \c true if the i-th dimension of the
      *        space is periodic, \c false otherwise.
+     * @param aPool the thread pool running the computation in parallel
+     * (e.g. &ThreadPool::defaultPool()), or nullptr (default) for a
+     * sequential computation.
      */
     PowerMap(ConstAlias<Domain> aDomain,
              ConstAlias<WeightImage> aWeightImage,
              ConstAlias<PowerSeparableMetric> aMetric,
-             PeriodicitySpec const & aPeriodicitySpec);
+             PeriodicitySpec const & aPeriodicitySpec,
+             ThreadPool* aPool = nullptr);
 
     /**
      * Disable default constructor.
@@ -324,16 +341,36 @@ namespace DGtal
      * SeparableMetric metric.  The method associates to each point
      * satisfying the foreground predicate, the closest site for which
      * the predicate is false. This algorithm is O(d.|domain size|).
+     *
+     * @param aPool the thread pool, or nullptr for a sequential computation.
      */
-    void compute ( ) ;
+    void compute ( ThreadPool* aPool ) ;
+
 
+    /// Scratch buffers of the 1D steps: the sites with unbounded
+    /// coordinates and the same sites projected into the domain.
+    typedef std::pair< std::vector<Point>, std::vector<Point> > SiteStacks;
+
+    /**
+     * Initializes the map on the slab of points whose last coordinate
+     * is @a slab and computes the steps along dimensions @f$ 0, \ldots,
+     * d-2 @f$ on this slab.
+     *
+     * @param slab the last coordinate of the slab.
+     * @param sites scratch buffers for the site stacks.
+     */
+    void computeSlab( const Abscissa slab, SiteStacks & sites ) const;
 
     /**
      *  Compute the other steps of the separable Power map.
      *
      * @param dim the dimension to process
+     * @param sites per-thread scratch buffers for the site stacks.
+     * @param pool the thread pool running the 1D problems.
      */
-    void computeOtherSteps(const Dimension dim) const;
+    void computeOtherSteps( const Dimension dim,
+                            std::vector<SiteStacks> & sites,
+                            ThreadPool & pool ) const;
 
     /**
      * Given  a voronoi map valid at dimension @a dim-1, this method
@@ -343,9 +380,11 @@ namespace DGtal
      *
      * @param row starting point of the 1D process.
      * @param dim dimension of the update.
+     * @param sites scratch buffers for the site stacks.
      */
     void computeOtherStep1D (const Point &row,
-                             const Dimension dim) const;
+                             const Dimension dim,
+                             SiteStacks & sites ) const;
 
     /**
      * Project point coordinates into the domain, taking into account
@@ -141,10 +141,12 @@ namespace DGtal
      */
     ReverseDistanceTransformation(ConstAlias<Domain> aDomain,
                                   ConstAlias<WeightImage> aWeightImage,
-                                  ConstAlias<PowerSeparableMetric> aMetric):
+                                  ConstAlias<PowerSeparableMetric> aMetric,
+                                  ThreadPool* aPool = nullptr):
       PowerMap<TWeightImage,TPSeparableMetric,TImageContainer>(aDomain,
                                                                aWeightImage,
-                                                               aMetric)
+                                                               aMetric,
+                                                               aPool)
     {}
 
     /**
@@ -155,11 +157,13 @@ namespace DGtal
     ReverseDistanceTransformation(ConstAlias<Domain> aDomain,
                                   ConstAlias<WeightImage> aWeightImage,
                                   ConstAlias<PowerSeparableMetric> aMetric,
-                                  typename Parent::PeriodicitySpec const & aPeriodicitySpec)
+                                  typename Parent::PeriodicitySpec const & aPeriodicitySpec,
+                                  ThreadPool* aPool = nullptr)
       : PowerMap<TWeightImage,TPSeparableMetric,TImageContainer>(aDomain,
                                                                  aWeightImage,
                                                                  aMetric,
-                                                                 aPeriodicitySpec)
+                                                                 aPeriodicitySpec,
+                                                                 aPool)
     {}
 
     /**
@@ -48,6 +48,7 @@
 #include <array>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CountedPtr.h"
+#include "DGtal/base/ThreadPool.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/images/CImage.h"
 #include "DGtal/kernel/CPointPredicate.h"
@@ -60,6 +61,38 @@
 namespace DGtal
 {
 
+  namespace detail
+  {
+    /**
+     * Given a voronoi map valid at dimension @a dim-1 along a non
+     * periodic 1D span, updates the span to make it consistent at
+     * dimension @a dim. Sites are read and written through functors,
+     * so that this step is shared by VoronoiMap and
+     * OutOfCoreDistanceTransformation.
+     *
+     * @param [in] metric the separable metric.
+     * @param [in] startPoint the first point of the 1D span.
+     * @param [in] endPoint the last point of the 1D span.
+     * @param [in] dim dimension of the update.
+     * @param [in] infinity the value of points without site.
+     * @param [in] getSite a functor returning the site of a point of the span.
+     * @param [in] setSite a functor setting the site of a point of the span.
+     * @param [in,out] sites scratch buffer for the site stack.
+     *
+     * @tparam TSeparableMetric a model of CSeparableMetric.
+     * @tparam TPoint the type of points and sites.
+     * @tparam TGetSite the type of a functor (Point) -> Point.
+     * @tparam TSetSite the type of a functor (Point, Point) -> void.
+     */
+    template < typename TSeparableMetric, typename TPoint,
+               typename TGetSite, typename TSetSite >
+    void voronoiStep1D( const TSeparableMetric & metric,
+                        const TPoint & startPoint, const TPoint & endPoint,
+                        const Dimension dim, const TPoint & infinity,
+                        TGetSite && getSite, TSetSite && setSite,
+                        std::vector< TPoint > & sites );
+  } // namespace detail
+
   /////////////////////////////////////////////////////////////////////////////
   // template class VoronoiMap
   /**
@@ -97,10 +130,17 @@ namespace DGtal
    * l_2@f$ metric, the overall computation is in @f$ O(d.n^d)@f$,
    * which is optimal.
    *
-   * If DGtal has been built with OpenMP support (WITH_OPENMP flag set
-   * to "true"), the computation is done in parallel (multithreaded)
+   * The computation is sequential by default. If a ThreadPool is
+   * given to the constructor, it is done in parallel (multithreaded)
    * in an optimal way: on @a p processors, expected runtime is in
-   * @f$ O(h.d.n^d / p)@f$.
+   * @f$ O(h.d.n^d / p)@f$. The initialization and the 1D steps along
+   * the first @f$ d-1@f$ dimensions are pipelined slab by slab (a slab
+   * being the set of points sharing the same last coordinate), the
+   * last step processes blocks of contiguous rows. Each thread reuses
+   * its own site stack. The point predicate and the image container
+   * must then support concurrent reads (and concurrent writes at
+   * distinct points for the latter), which is not the case of
+   * e.g. TiledImage or predicates with a mutable state.
    *
    * This class is a model of concepts::CConstImage.
    *
@@ -204,10 +244,15 @@ namespace DGtal
      * Voronoi sites (false points).
      *
      * @param aMetric a pointer to the separable metric instance.
+     *
+     * @param aPool the thread pool running the computation in parallel
+     * (e.g. &ThreadPool::defaultPool()), or nullptr (default) for a
+     * sequential computation.
      */
     VoronoiMap(ConstAlias<Domain> aDomain,
                ConstAlias<PointPredicate> predicate,
-               ConstAlias<SeparableMetric> aMetric);
+               ConstAlias<SeparableMetric> aMetric,
+               ThreadPool* aPool = nullptr);
 
     /**
      * Constructor with periodicity specification.
@@ -232,11 +277,16 @@ namespace DGtal
      * @param aPeriodicitySpec an array of size equal to the space dimension
      *        where the i-th value is \c true if the i-th dimension of the
      *        space is periodic, \c false otherwise.
+     *
+     * @param aPool the thread pool running the computation in parallel
+     * (e.g. &ThreadPool::defaultPool()), or nullptr (default) for a
+     * sequential computation.
      */
     VoronoiMap(ConstAlias<Domain> aDomain,
                ConstAlias<PointPredicate> predicate,
                ConstAlias<SeparableMetric> aMetric,
-               PeriodicitySpec const & aPeriodicitySpec);
+               PeriodicitySpec const & aPeriodicitySpec,
+               ThreadPool* aPool = nullptr);
     /**
      * Default destructor
      */
@@ -341,16 +391,32 @@ namespace DGtal
      * SeparableMetric metric.  The method associates to each point
      * satisfying the foreground predicate, the closest site for which
      * the predicate is false. This algorithm is O(h.d.|domain size|).
+     *
+     * @param [in] aPool the thread pool, or nullptr for a sequential computation.
      */
-    void compute ( ) ;
+    void compute ( ThreadPool* aPool ) ;
+
 
+    /**
+     * Initializes the map on the slab of points whose last coordinate
+     * is @a slab and computes the steps along dimensions @f$ 0, \ldots,
+     * d-2 @f$ on this slab.
+     *
+     * @param [in] slab the last coordinate of the slab.
+     * @param [in,out] sites scratch buffer for the site stacks.
+     */
+    void computeSlab( const Abscissa slab, std::vector<Point> & sites ) const;
 
     /**
      *  Compute the other steps of the separable Voronoi map.
      *
      * @param [in] dim the dimension to process
+     * @param [in,out] sites per-thread scratch buffers for the site stacks.
+     * @param [in] pool the thread pool running the 1D problems.
      */
-    void computeOtherSteps(const Dimension dim) const;
+    void computeOtherSteps( const Dimension dim,
+                            std::vector< std::vector<Point> > & sites,
+                            ThreadPool & pool ) const;
     /**
      * Given  a voronoi map valid at dimension @a dim-1, this method
      * updates the map to make it consistent at dimension @a dim along
@@ -359,9 +425,11 @@ namespace DGtal
      *
      * @param [in] row starting point of the 1D process.
      * @param [in] dim dimension of the update.
+     * @param [in,out] sites scratch buffer for the site stack.
      */
     void computeOtherStep1D (const Point &row,
-                             const Dimension dim) const;
+                             const Dimension dim,
+                             std::vector<Point> & sites ) const;
 
     /**
      * Project a coordinate into the domain, taking into account
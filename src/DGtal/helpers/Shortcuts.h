@@ -54,9 +54,12 @@
 #include "DGtal/math/MPolynomial.h"
 #include "DGtal/math/Statistic.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerByIntervals.h"
 #include "DGtal/images/IntervalForegroundPredicate.h"
 #include <DGtal/images/ImageLinearCellEmbedder.h>
 #include "DGtal/shapes/implicit/ImplicitPolynomial3Shape.h"
+#include "DGtal/shapes/implicit/ImplicitPolynomial3Digitizer.h"
+#include "DGtal/shapes/AdaptiveGaussDigitizer.h"
 #include "DGtal/shapes/GaussDigitizer.h"
 #include "DGtal/shapes/ShapeGeometricFunctors.h"
 #include "DGtal/shapes/MeshHelpers.h"
@@ -139,6 +142,9 @@ namespace DGtal
       typedef GaussDigitizer< Space, ImplicitShape3D >     DigitizedImplicitShape3D;
       /// defines a black and white image with (hyper-)rectangular domain.
       typedef ImageContainerBySTLVector<Domain, bool>      BinaryImage;
+      /// defines a black and white image stored as runs of foreground
+      /// points, well suited to large sparse shapes.
+      typedef ImageContainerByIntervals<Domain>            IntervalBinaryImage;
       /// defines a grey-level image with (hyper-)rectangular domain.
       typedef ImageContainerBySTLVector<Domain, GrayScale> GrayScaleImage;
       /// defines a float image with (hyper-)rectangular domain.
@@ -364,6 +370,24 @@ namespace DGtal
         return K;
       }
 
+      /// Builds a Khalimsky space that encompasses the domain of the given image.
+      /// Note that digital points are cells of the Khalimsky space with
+      /// maximal dimensions.  A closed Khalimsky space adds lower
+      /// dimensional cells all around its boundary to define a closed
+      /// complex.
+      ///
+      /// @param[in] bimage any binary image stored by intervals
+      /// @param[in] params the parameters:
+      ///   - closed   [1]: specifies if the Khalimsky space is closed (!=0) or not (==0).
+      ///
+      /// @return the Khalimsky space.
+      static KSpace getKSpace( CountedPtr<IntervalBinaryImage> bimage,
+                               Parameters params = parametersKSpace() )
+      {
+        return getKSpace( bimage->domain().lowerBound(),
+                          bimage->domain().upperBound(), params );
+      }
+
       /// Builds a Khalimsky space that encompasses the domain of the given image.
       /// Note that digital points are cells of the Khalimsky space with
       /// maximal dimensions.  A closed Khalimsky space adds lower
@@ -600,11 +624,10 @@ namespace DGtal
         const Scalar noise        = params[ "noise"  ].as<Scalar>();
         CountedPtr<BinaryImage> img ( new BinaryImage( shapeDomain ) );
         if ( noise <= 0.0 )
-          {
-            std::transform( shapeDomain.begin(), shapeDomain.end(),
-                            img->begin(),
-                            [&shape_digitization]
-                            ( const Point& p ) { return (*shape_digitization)(p); } );
+          { // same result as evaluating the digitizer at each point.
+            ImplicitPolynomial3Digitizer< Space > digitizer
+              ( shape_digitization->shape(), shape_digitization->gridSteps() );
+            digitizer.digitize( *img );
           }
         else
           {
@@ -617,6 +640,35 @@ namespace DGtal
         return img;
       }
 
+      /// Vectorizes the Gauss digitization of any Euclidean shape
+      /// (e.g. ImplicitBall, or a star-shaped object) into a binary
+      /// image with AdaptiveGaussDigitizer: only the blocks that \a
+      /// classifier cannot decide are evaluated point by point. The
+      /// result may then be noisified depending on \a params.
+      ///
+      /// @tparam TEuclideanShape a model of CEuclideanOrientedShape.
+      /// @tparam TBlockClassifier a block classifier of the shape (e.g.
+      /// functors::LipschitzBlockClassifier or functors::BallBlockClassifier).
+      ///
+      /// @param[in] digitizer an initialized Gauss digitizer of the shape.
+      /// @param[in] classifier the block classifier of the shape.
+      /// @param[in] params the parameters:
+      ///   - noise   [0.0]: specifies the Kanungo noise level for binary pictures.
+      ///
+      /// @return a smart pointer on a binary image that samples the digital shape.
+      template <typename TEuclideanShape, typename TBlockClassifier>
+      static CountedPtr<BinaryImage>
+        makeBinaryImage( const GaussDigitizer< Space, TEuclideanShape > & digitizer,
+                         const TBlockClassifier & classifier,
+                         Parameters params = parametersBinaryImage() )
+      {
+        CountedPtr<BinaryImage> img ( new BinaryImage( digitizer.getDomain() ) );
+        AdaptiveGaussDigitizer< Space, TEuclideanShape, TBlockClassifier >
+          adaptive( digitizer, classifier );
+        adaptive.digitize( *img );
+        return makeBinaryImage( img, params );
+      }
+
       /// Adds Kanungo noise to a binary image and returns the resulting new image. 
       ///
       /// @param[in] bimage a smart pointer on a binary image.
@@ -697,6 +749,139 @@ namespace DGtal
         return makeBinaryImage( img, params );
       }
 
+
+      /// Vectorizes an implicitly defined digital shape into a binary
+      /// image stored by intervals, and possibly add Kanungo noise to
+      /// the result depending on parameters given in \a params. The
+      /// dense image is never built.
+      ///
+      /// @param[in] shape_digitization a smart pointer on an implicit digital shape.
+      /// @param[in] params the parameters:
+      ///   - noise   [0.0]: specifies the Kanungo noise level for binary pictures.
+      ///
+      /// @return a smart pointer on a binary image that samples the digital shape.
+      static CountedPtr<IntervalBinaryImage>
+        makeIntervalBinaryImage( CountedPtr<DigitizedImplicitShape3D> shape_digitization,
+                                 Parameters params = parametersBinaryImage() )
+      {
+        const Scalar noise        = params[ "noise"  ].as<Scalar>();
+        const Domain shapeDomain  = shape_digitization->getDomain();
+        if ( noise <= 0.0 )
+          { // same digitization as makeBinaryImage.
+            CountedPtr<IntervalBinaryImage> img ( new IntervalBinaryImage( shapeDomain ) );
+            ImplicitPolynomial3Digitizer< Space > digitizer
+              ( shape_digitization->shape(), shape_digitization->gridSteps() );
+            digitizer.digitize( *img );
+            return img;
+          }
+        typedef KanungoNoise< DigitizedImplicitShape3D, Domain > KanungoPredicate;
+        KanungoPredicate noisy_dshape( *shape_digitization, shapeDomain, noise );
+        return CountedPtr<IntervalBinaryImage>
+          ( new IntervalBinaryImage( shapeDomain, noisy_dshape ) );
+      }
+
+      /// Vectorizes the Gauss digitization of any Euclidean shape into
+      /// a binary image stored by intervals with AdaptiveGaussDigitizer,
+      /// and possibly add Kanungo noise to the result depending on
+      /// parameters given in \a params. The dense image is never built.
+      ///
+      /// @tparam TEuclideanShape a model of CEuclideanOrientedShape.
+      /// @tparam TBlockClassifier a block classifier of the shape (e.g.
+      /// functors::LipschitzBlockClassifier or functors::BallBlockClassifier).
+      ///
+      /// @param[in] digitizer an initialized Gauss digitizer of the shape.
+      /// @param[in] classifier the block classifier of the shape.
+      /// @param[in] params the parameters:
+      ///   - noise   [0.0]: specifies the Kanungo noise level for binary pictures.
+      ///
+      /// @return a smart pointer on a binary image that samples the digital shape.
+      template <typename TEuclideanShape, typename TBlockClassifier>
+      static CountedPtr<IntervalBinaryImage>
+        makeIntervalBinaryImage( const GaussDigitizer< Space, TEuclideanShape > & digitizer,
+                                 const TBlockClassifier & classifier,
+                                 Parameters params = parametersBinaryImage() )
+      {
+        const Scalar noise        = params[ "noise"  ].as<Scalar>();
+        const Domain shapeDomain  = digitizer.getDomain();
+        CountedPtr<IntervalBinaryImage> img ( new IntervalBinaryImage( shapeDomain ) );
+        AdaptiveGaussDigitizer< Space, TEuclideanShape, TBlockClassifier >
+          adaptive( digitizer, classifier );
+        adaptive.digitize( *img );
+        if ( noise <= 0.0 ) return img;
+        typedef KanungoNoise< IntervalBinaryImage, Domain > KanungoPredicate;
+        KanungoPredicate noisy_dshape( *img, shapeDomain, noise );
+        return CountedPtr<IntervalBinaryImage>
+          ( new IntervalBinaryImage( shapeDomain, noisy_dshape ) );
+      }
+
+      /// Converts a binary image into a binary image stored by
+      /// intervals, and possibly add Kanungo noise to the result
+      /// depending on parameters given in \a params.
+      ///
+      /// @param[in] bimage a smart pointer on a binary image.
+      /// @param[in] params the parameters:
+      ///   - noise   [0.0]: specifies the Kanungo noise level for binary pictures.
+      ///
+      /// @return a smart pointer on a binary image stored by intervals.
+      static CountedPtr<IntervalBinaryImage>
+        makeIntervalBinaryImage( CountedPtr<BinaryImage> bimage,
+                                 Parameters params = parametersBinaryImage() )
+      {
+        const Scalar noise        = params[ "noise"  ].as<Scalar>();
+        const Domain shapeDomain  = bimage->domain();
+        if ( noise <= 0.0 )
+          return CountedPtr<IntervalBinaryImage>
+            ( new IntervalBinaryImage( shapeDomain, *bimage ) );
+        typedef KanungoNoise< BinaryImage, Domain > KanungoPredicate;
+        KanungoPredicate noisy_dshape( *bimage, shapeDomain, noise );
+        return CountedPtr<IntervalBinaryImage>
+          ( new IntervalBinaryImage( shapeDomain, noisy_dshape ) );
+      }
+
+      /// Binarizes an arbitrary gray scale image and returns the
+      /// binary image stored by intervals corresponding to the
+      /// threshold parameters.
+      ///
+      /// @param[in] gray_scale_image the input gray scale image.
+      /// @param[in] params the parameters:
+      ///   - thresholdMin [  0]: specifies the threshold min (excluded) to define binary shape
+      ///   - thresholdMax [255]: specifies the threshold max (included) to define binary shape
+      ///
+      /// @return a smart pointer on a binary image stored by intervals
+      /// that represents the thresholded gray scale image.
+      static CountedPtr<IntervalBinaryImage>
+        makeIntervalBinaryImage
+        ( CountedPtr<GrayScaleImage> gray_scale_image,
+          Parameters params = parametersBinaryImage() )
+      {
+        int     thresholdMin = params["thresholdMin"].as<int>();
+        int     thresholdMax = params["thresholdMax"].as<int>();
+        typedef functors::IntervalForegroundPredicate<GrayScaleImage> ThresholdedImage;
+        ThresholdedImage tImage( *gray_scale_image, thresholdMin, thresholdMax );
+        return CountedPtr<IntervalBinaryImage>
+          ( new IntervalBinaryImage( gray_scale_image->domain(), tImage ) );
+      }
+
+      /// Loads an arbitrary image file (e.g. vol file in 3D) and returns
+      /// the binary image stored by intervals corresponding to the
+      /// threshold parameters.
+      ///
+      /// @param[in] input the input filename.
+      /// @param[in] params the parameters:
+      ///   - thresholdMin [  0]: specifies the threshold min (excluded) to define binary shape
+      ///   - thresholdMax [255]: specifies the threshold max (included) to define binary shape
+      ///
+      /// @return a smart pointer on a binary image stored by intervals
+      /// that represents the thresholded image file.
+      static CountedPtr<IntervalBinaryImage>
+        makeIntervalBinaryImage
+        ( std::string input,
+          Parameters params = parametersBinaryImage() )
+      {
+        CountedPtr<GrayScaleImage> image
+          ( new GrayScaleImage( GenericReader<GrayScaleImage>::import( input ) ) );
+        return makeIntervalBinaryImage( image, params );
+      }
     
       /// Saves an arbitrary binary image file (e.g. vol file in 3D).
       ///
@@ -1128,6 +1313,10 @@ namespace DGtal
       /// surfaces in the binary image \a bimage, or any one of its big
       /// components according to parameters.
       ///
+      /// With "All" components, the boundary components are extracted
+      /// in parallel by Surfaces::sMakeBoundaryComponents, which reads
+      /// \a bimage concurrently from several threads.
+      ///
       /// @param[out] surfel_reps a vector of surfels, one surfel per
       /// digital surface component.
       ///
@@ -1161,23 +1350,20 @@ namespace DGtal
           }	
         bool surfel_adjacency      = params[ "surfelAdjacency" ].as<int>();
         SurfelAdjacency< KSpace::dimension > surfAdj( surfel_adjacency );
-        // Extracts all boundary surfels
-        SurfelSet all_surfels;
-        Surfaces<KSpace>::sMakeBoundary( all_surfels, K, *bimage,
-                                         K.lowerBound(), K.upperBound() );
-        // Builds all connected components of surfels.
-        SurfelSet marked_surfels;
+        // Extracts all connected components of boundary surfels in
+        // parallel. Each one is represented by its smallest surfel.
+        std::vector< SurfelRange > components;
+        Surfaces<KSpace>::sMakeBoundaryComponents( components, K, surfAdj, *bimage,
+                                                   K.lowerBound(), K.upperBound() );
         CountedPtr<LightDigitalSurface> ptrSurface;
-        for ( auto bel : all_surfels )
+        for ( auto const & comp : components )
           {
-            if ( marked_surfels.count( bel ) != 0 ) continue;
+            const Surfel bel = comp.front();
             surfel_reps.push_back( bel );
             LightSurfaceContainer* surfContainer
               = new LightSurfaceContainer( K, *bimage, surfAdj, bel );
             ptrSurface = CountedPtr<LightDigitalSurface>
               ( new LightDigitalSurface( surfContainer ) ); // acquired
-            // mark all surfels of the surface component.
-            marked_surfels.insert( ptrSurface->begin(), ptrSurface->end() );
             // add surface component to result.
             result.push_back( ptrSurface );
           }
@@ -1222,6 +1408,92 @@ namespace DGtal
 	    ( new DigitalSurface( surfContainer ) ); // acquired
         }
 
+      /// Creates a explicit digital surface representing the boundaries
+      /// in the binary image \a bimage stored by intervals. Surfels
+      /// are extracted run by run: those orthogonal to the first axis
+      /// are the run extremities, the others are the symmetric
+      /// differences of the runs of adjacent rows. The background of
+      /// the domain is never scanned.
+      ///
+      /// @param[in] bimage a binary image stored by intervals.
+      ///
+      /// @param[in] K the Khalimsky space whose domain encompasses the
+      /// digital shape.
+      ///
+      /// @param[in] params the parameters:
+      ///   - surfelAdjacency   [       0]: specifies the surfel adjacency (1:ext, 0:int)
+      ///
+      /// @return a smart pointer on the explicit digital surface
+      /// representing the boundaries in the binary image.
+      static CountedPtr< DigitalSurface >
+        makeDigitalSurface
+        ( CountedPtr< IntervalBinaryImage > bimage,
+          const KSpace&           K,
+          const Parameters&       params = parametersDigitalSurface() )
+        {
+          typedef typename IntervalBinaryImage::Intervals Intervals;
+          SurfelSet all_surfels;
+          bool      surfel_adjacency = params[ "surfelAdjacency" ].as<int>();
+          SurfelAdjacency< KSpace::dimension > surfAdj( surfel_adjacency );
+          const Point low = K.lowerBound();
+          const Point up  = K.upperBound();
+          // Adds the surfels between p (in iff in_here) and p + e_k,
+          // for all p in the row of q with first coordinate in I.
+          auto addSurfels = [&] ( Point q, const Intervals& I,
+                                  Dimension k, bool in_here )
+            {
+              for ( auto const & run : I.data() )
+                for ( q[ 0 ] = std::max( run.first, low[ 0 ] );
+                      q[ 0 ] <= std::min( run.second, up[ 0 ] ); ++q[ 0 ] )
+                  all_surfels.insert( K.sIncident( K.sSpel( q, in_here ), k, true ) );
+            };
+          auto inside = [&] ( const Point& q ) // q[ 0 ] is not checked.
+            {
+              for ( Dimension i = 1; i < KSpace::dimension; ++i )
+                if ( q[ i ] < low[ i ] || up[ i ] < q[ i ] ) return false;
+              return true;
+            };
+          const auto & rows = bimage->container().data();
+          for ( auto const & row : rows )
+            {
+              Point q = row.first;
+              if ( ! inside( q ) ) continue;
+              // Extremities of runs, along the first axis.
+              for ( auto const & run : row.second.data() )
+                {
+                  q[ 0 ] = run.first - 1;
+                  if ( low[ 0 ] <= q[ 0 ] && q[ 0 ] < up[ 0 ] )
+                    all_surfels.insert( K.sIncident( K.sSpel( q, false ), 0, true ) );
+                  q[ 0 ] = run.second;
+                  if ( low[ 0 ] <= q[ 0 ] && q[ 0 ] < up[ 0 ] )
+                    all_surfels.insert( K.sIncident( K.sSpel( q, true ), 0, true ) );
+                }
+              q = row.first;
+              // Differences with the neighbor rows, along the other axes.
+              for ( Dimension k = 1; k < KSpace::dimension; ++k )
+                {
+                  Point r = q; r[ k ] += 1;
+                  if ( q[ k ] < up[ k ] )
+                    {
+                      auto it = rows.find( r );
+                      if ( it == rows.end() )
+                        addSurfels( q, row.second, k, true );
+                      else
+                        {
+                          addSurfels( q, row.second.set_difference( it->second ), k, true );
+                          addSurfels( q, it->second.set_difference( row.second ), k, false );
+                        }
+                    }
+                  Point s = q; s[ k ] -= 1;
+                  if ( low[ k ] < q[ k ] && rows.find( s ) == rows.end() )
+                    addSurfels( s, row.second, k, false );
+                }
+            }
+          ExplicitSurfaceContainer* surfContainer
+            = new ExplicitSurfaceContainer( K, surfAdj, all_surfels );
+          return CountedPtr< DigitalSurface >
+	    ( new DigitalSurface( surfContainer ) ); // acquired
+        }
 
       /// Builds a explicit digital surface from an indexed digital surface.
       ///
@@ -1284,9 +1556,11 @@ namespace DGtal
             surfels.insert( light_surface->begin(), light_surface->end() );
           }
         else if ( component == "All" )
-          {
-            Surfaces<KSpace>::sMakeBoundary( surfels, K, *bimage,
-                                             K.lowerBound(), K.upperBound() );
+          { // Sorted surfels, extracted in parallel.
+            SurfelRange all_surfels;
+            Surfaces<KSpace>::sMakeIndexedBoundary( all_surfels, K, *bimage,
+                                                    K.lowerBound(), K.upperBound() );
+            return makeIdxDigitalSurface( all_surfels, K, params );
           }
         return makeIdxDigitalSurface( surfels, K, params );
       }    
@@ -639,6 +639,15 @@ namespace DGtal
       ///   - kernel          [ "hat"]: the kernel integration function chi_r, either "hat" or "ball". )
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - surfelEmbedding [     0]: the surfel -> point embedding for VCM estimator: 0: Pointels, 1: InnerSpel, 2: OuterSpel.
+      ///   - ii-mode         ["direct"]: the II convolution mode, either "direct" (kernel sums around each surfel) or "fft" (FFT convolutions, faster for large radii, requires WITH_FFTW3).
+      ///
+      /// @note The Integral Invariant estimations (getII... methods)
+      /// accept surfels in any order: they are sorted into chains of
+      /// adjacent surfels and processed in parallel (see
+      /// IntegralInvariantVolumeEstimator::evalBatch). When they are
+      /// given an implicit shape, it must thus support concurrent
+      /// evaluations. Results are always returned in the order of the
+      /// given surfels.
       static Parameters parametersGeometryEstimation()
       {
         return Parameters
@@ -648,7 +657,8 @@ namespace DGtal
           ( "R-radius",       10.0 )
           ( "r-radius",        3.0 )
           ( "alpha",          0.33 )
-          ( "surfelEmbedding",   0 );
+          ( "surfelEmbedding",   0 )
+          ( "ii-mode",    "direct" );
       }
 
       /// Given a digital space \a K and a vector of \a surfels,
@@ -832,6 +842,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - ii-mode         ["direct"]: the II convolution mode (see parametersGeometryEstimation).
       ///
       /// @return the vector containing the estimated normals, in the
       /// same order as \a surfels.
@@ -839,9 +850,6 @@ namespace DGtal
       /// @note Be careful, normals are reoriented with respect to
       /// Trivial normals. If you wish a more robust orientation, use
       /// getCTrivialNormalVectors.
-      ///
-      /// @note It is better to have surfels in a specific order, as
-      /// given for instance by a depth-first traversal (see @ref getSurfelRange)
       static RealVectors
         getIINormalVectors( CountedPtr<BinaryImage> bimage,
                             const SurfelRange&      surfels,
@@ -867,6 +875,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - ii-mode         ["direct"]: the II convolution mode (see parametersGeometryEstimation).
       ///   - minAABB         [ -10.0]: the min value of the AABB bounding box (domain)
       ///   - maxAABB         [  10.0]: the max value of the AABB bounding box (domain)
       ///   - offset          [   5.0]: the digital dilation of the digital space,
@@ -879,9 +888,6 @@ namespace DGtal
       /// @note Be careful, normals are reoriented with respect to
       /// Trivial normals. If you wish a more robust orientation, use
       /// getCTrivialNormalVectors.
-      ///
-      /// @note It is better to have surfels in a specific order, as
-      /// given for instance by a depth-first traversal (see @ref getSurfelRange)
       static RealVectors
         getIINormalVectors( CountedPtr< DigitizedImplicitShape3D > dshape,
                             const SurfelRange&      surfels,
@@ -908,6 +914,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - ii-mode         ["direct"]: the II convolution mode (see parametersGeometryEstimation).
       ///
       /// @return the vector containing the estimated normals, in the
       /// same order as \a surfels.
@@ -915,9 +922,6 @@ namespace DGtal
       /// @note Be careful, normals are reoriented with respect to
       /// Trivial normals. If you wish a more robust orientation, use
       /// getCTrivialNormalVectors.
-      ///
-      /// @note It is better to have surfels in a specific order, as
-      /// given for instance by a depth-first traversal (see @ref getSurfelRange)
       template <typename TPointPredicate>
         static RealVectors
         getIINormalVectors( const TPointPredicate&  shape,
@@ -949,8 +953,8 @@ namespace DGtal
           ii_estimator.attach( K, shape );
           ii_estimator.setParams( r );
           ii_estimator.init( h, surfels.begin(), surfels.end() );
-          ii_estimator.eval( surfels.begin(), surfels.end(),
-                             std::back_inserter( n_estimations ) );
+          evalIIEstimator( ii_estimator, surfels, params,
+                           std::back_inserter( n_estimations ) );
           const RealVectors n_trivial = getTrivialNormalVectors( K, surfels );
           orientVectors( n_estimations, n_trivial );
           return n_estimations;
@@ -969,12 +973,10 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - ii-mode         ["direct"]: the II convolution mode (see parametersGeometryEstimation).
       ///
       /// @return the vector containing the estimated mean curvatures, in the
       /// same order as \a surfels.
-      ///
-      /// @note The function is faster when surfels are in a specific order, as
-      /// given for instance by a depth-first traversal (see @ref getSurfelRange)
       static Scalars
         getIIMeanCurvatures( CountedPtr<BinaryImage> bimage,
                              const SurfelRange&      surfels,
@@ -1000,6 +1002,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - ii-mode         ["direct"]: the II convolution mode (see parametersGeometryEstimation).
       ///   - minAABB         [ -10.0]: the min value of the AABB bounding box (domain)
       ///   - maxAABB         [  10.0]: the max value of the AABB bounding box (domain)
       ///   - offset          [   5.0]: the digital dilation of the digital space,
@@ -1008,9 +1011,6 @@ namespace DGtal
       ///
       /// @return the vector containing the estimated mean curvatures, in the
       /// same order as \a surfels.
-      ///
-      /// @note It is better to have surfels in a specific order, as
-      /// given for instance by a depth-first traversal (see @ref getSurfelRange)
       static Scalars
         getIIMeanCurvatures( CountedPtr< DigitizedImplicitShape3D > dshape,
                              const SurfelRange&      surfels,
@@ -1039,12 +1039,10 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - ii-mode         ["direct"]: the II convolution mode (see parametersGeometryEstimation).
       ///
       /// @return the vector containing the estimated mean curvatures, in the
       /// same order as \a surfels.
-      ///
-      /// @note The function is faster when surfels are in a specific order, as
-      /// given for instance by a depth-first traversal (see @ref getSurfelRange)
       template <typename TPointPredicate>
         static Scalars
         getIIMeanCurvatures( const TPointPredicate&  shape,
@@ -1076,8 +1074,8 @@ namespace DGtal
           ii_estimator.attach( K, shape );
           ii_estimator.setParams( r );
           ii_estimator.init( h, surfels.begin(), surfels.end() );
-          ii_estimator.eval( surfels.begin(), surfels.end(),
-                             std::back_inserter( mc_estimations ) );
+          evalIIEstimator( ii_estimator, surfels, params,
+                           std::back_inserter( mc_estimations ) );
           return mc_estimations;
         }
 
@@ -1093,12 +1091,10 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - ii-mode         ["direct"]: the II convolution mode (see parametersGeometryEstimation).
       ///
       /// @return the vector containing the estimated Gaussian curvatures, in the
       /// same order as \a surfels.
-      ///
-      /// @note The function is faster when surfels are in a specific order, as
-      /// given for instance by a depth-first traversal (see @ref getSurfelRange)
       static Scalars
         getIIGaussianCurvatures( CountedPtr<BinaryImage> bimage,
                                  const SurfelRange&      surfels,
@@ -1124,6 +1120,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - ii-mode         ["direct"]: the II convolution mode (see parametersGeometryEstimation).
       ///   - minAABB         [ -10.0]: the min value of the AABB bounding box (domain)
       ///   - maxAABB         [  10.0]: the max value of the AABB bounding box (domain)
       ///   - offset          [   5.0]: the digital dilation of the digital space,
@@ -1132,9 +1129,6 @@ namespace DGtal
       ///
       /// @return the vector containing the estimated Gaussian curvatures, in the
       /// same order as \a surfels.
-      ///
-      /// @note It is better to have surfels in a specific order, as
-      /// given for instance by a depth-first traversal (see @ref getSurfelRange)
       static Scalars
         getIIGaussianCurvatures( CountedPtr< DigitizedImplicitShape3D > dshape,
                                  const SurfelRange&      surfels,
@@ -1163,12 +1157,10 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - ii-mode         ["direct"]: the II convolution mode (see parametersGeometryEstimation).
       ///
       /// @return the vector containing the estimated Gaussian curvatures, in the
       /// same order as \a surfels.
-      ///
-      /// @note The function is faster when surfels are in a specific order, as
-      /// given for instance by a depth-first traversal (see @ref getSurfelRange)
       template <typename TPointPredicate>
         static Scalars
         getIIGaussianCurvatures( const TPointPredicate&  shape,
@@ -1200,8 +1192,8 @@ namespace DGtal
           ii_estimator.attach( K, shape );
           ii_estimator.setParams( r );
           ii_estimator.init( h, surfels.begin(), surfels.end() );
-          ii_estimator.eval( surfels.begin(), surfels.end(),
-                             std::back_inserter( mc_estimations ) );
+          evalIIEstimator( ii_estimator, surfels, params,
+                           std::back_inserter( mc_estimations ) );
           return mc_estimations;
         }
 
@@ -1218,12 +1210,10 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - ii-mode         ["direct"]: the II convolution mode (see parametersGeometryEstimation).
       ///
       /// @return the vector containing the estimated Gaussian curvatures, in the
       /// same order as \a surfels.
-      ///
-      /// @note The function is faster when surfels are in a specific order, as
-      /// given for instance by a depth-first traversal (see @ref getSurfelRange)
       static CurvatureTensorQuantities
       getIIPrincipalCurvaturesAndDirections( CountedPtr<BinaryImage> bimage,
                                           const SurfelRange&      surfels,
@@ -1250,6 +1240,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - ii-mode         ["direct"]: the II convolution mode (see parametersGeometryEstimation).
       ///   - minAABB         [ -10.0]: the min value of the AABB bounding box (domain)
       ///   - maxAABB         [  10.0]: the max value of the AABB bounding box (domain)
       ///   - offset          [   5.0]: the digital dilation of the digital space,
@@ -1258,9 +1249,6 @@ namespace DGtal
       ///
       /// @return the vector containing the estimated principal curvatures and directions, in the
       /// same order as \a surfels.
-      ///
-      /// @note It is better to have surfels in a specific order, as
-      /// given for instance by a depth-first traversal (see @ref getSurfelRange)
       static CurvatureTensorQuantities
       getIIPrincipalCurvaturesAndDirections( CountedPtr< DigitizedImplicitShape3D > dshape,
                                           const SurfelRange&      surfels,
@@ -1289,12 +1277,10 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - ii-mode         ["direct"]: the II convolution mode (see parametersGeometryEstimation).
       ///
       /// @return the vector containing the estimated principal curvatures and directions,
       ///  in the same order as \a surfels.
-      ///
-      /// @note The function is faster when surfels are in a specific order, as
-      /// given for instance by a depth-first traversal (see @ref getSurfelRange)
       template <typename TPointPredicate>
       static CurvatureTensorQuantities
       getIIPrincipalCurvaturesAndDirections( const TPointPredicate&  shape,
@@ -1325,8 +1311,8 @@ namespace DGtal
         ii_estimator.attach( K, shape );
         ii_estimator.setParams( r );
         ii_estimator.init( h, surfels.begin(), surfels.end() );
-        ii_estimator.eval( surfels.begin(), surfels.end(),
-                          std::back_inserter( mc_estimations ) );
+        evalIIEstimator( ii_estimator, surfels, params,
+                         std::back_inserter( mc_estimations ) );
         return mc_estimations;
       }
 
@@ -1809,6 +1795,46 @@ namespace DGtal
       // ------------------------- Hidden services ------------------------------
     protected:
 
+      /// Evaluates an Integral Invariant estimator on \a surfels, either
+      /// by direct summation of the kernel around each surfel (see
+      /// IntegralInvariantVolumeEstimator::evalBatch) or with FFT
+      /// convolutions (see IntegralInvariantVolumeEstimator::evalFFT).
+      ///
+      /// @tparam TIIEstimator either IntegralInvariantVolumeEstimator or IntegralInvariantCovarianceEstimator.
+      /// @tparam TOutputIterator an output iterator on the estimated quantities.
+      ///
+      /// @param[in] ii_estimator an initialized Integral Invariant estimator.
+      /// @param[in] surfels the sequence of surfels at which we compute the quantities.
+      /// @param[in] params the parameters:
+      ///   - ii-mode         ["direct"]: the II convolution mode (see parametersGeometryEstimation).
+      /// @param[out] result the output iterator where quantities are written, in the same order as \a surfels.
+      template <typename TIIEstimator, typename TOutputIterator>
+        static void
+        evalIIEstimator( const TIIEstimator& ii_estimator,
+                         const SurfelRange&  surfels,
+                         const Parameters&   params,
+                         TOutputIterator     result )
+      {
+        const std::string mode = params.count( "ii-mode" )
+          ? params[ "ii-mode" ].as<std::string>() : std::string( "direct" );
+#ifdef WITH_FFTW3
+        if ( mode == "fft" )
+          {
+            ii_estimator.evalFFT( surfels.begin(), surfels.end(), result );
+            return;
+          }
+#endif
+        if ( mode == "fft" )
+          trace.warning() << "[ShortcutsGeometry::evalIIEstimator]"
+                          << " ii-mode=fft requires FFTW3 (WITH_FFTW3), using direct summation."
+                          << std::endl;
+        else if ( mode != "direct" )
+          trace.warning() << "[ShortcutsGeometry::evalIIEstimator]"
+                          << " unknown ii-mode=" << mode << ", using direct summation."
+                          << std::endl;
+        ii_estimator.evalBatch( surfels.begin(), surfels.end(), result );
+      }
+
       // ------------------------- Internals ------------------------------------
     private:
 
@@ -0,0 +1,444 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageContainerByBricks.h
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module ImageContainerByBricks.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageContainerByBricks_RECURSES)
+#error Recursive header files inclusion detected in ImageContainerByBricks.h
+#else // defined(ImageContainerByBricks_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageContainerByBricks_RECURSES
+
+#if !defined ImageContainerByBricks_h
+/** Prevents repeated inclusion of headers. */
+#define ImageContainerByBricks_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CowPtr.h"
+#include "DGtal/base/Clone.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+#include "DGtal/images/DefaultImageRange.h"
+#include "DGtal/images/SetValueIterator.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageContainerByBricks
+  /**
+   * Description of template class 'ImageContainerByBricks' <p>
+   * \brief Aim: Model of concepts::CImage storing the values of an
+   * image defined on an HyperRectDomain in cubic bricks of side
+   * 2^TLogBrickSize, e.g. 8x8x8 bricks by default.
+   *
+   * Bricks are stored in the Morton order of their positions in the
+   * grid of bricks, and the values of a brick are stored in the
+   * Morton order of their positions in the brick. Points that are
+   * close in the domain are thus close in memory, whatever the axis
+   * along which they are neighbors.
+   *
+   * A brick whose values are all equal only stores this value: the
+   * image is built with uniform bricks, a brick is expanded the first
+   * time a different value is written in it, and compress() collapses
+   * the expanded bricks that became uniform. The former values of
+   * expanded bricks are reclaimed when they are as many as half the
+   * bricks, so that the storage stays bounded. Large homogeneous regions
+   * (e.g. the background of a segmented volume) cost a few bytes per
+   * brick.
+   *
+   * Besides the usual image services, the points of the domain can
+   * be traversed in the storage order (see brickOrderBegin() and
+   * brickOrderEnd()), which is cache friendly for algorithms that
+   * read the neighbors of each point, and bricks can be traversed
+   * directly (see nbBricks(), isUniform() and brickLowerBound()).
+   *
+   * @tparam TDomain an HyperRectDomain.
+   * @tparam TValue the type of the values.
+   * @tparam TLogBrickSize the logarithm in base 2 of the side of the bricks.
+   *
+   * @see testImageContainerByBricks.cpp
+   */
+  template <typename TDomain, typename TValue, unsigned int TLogBrickSize = 3>
+  class ImageContainerByBricks
+  {
+  public:
+
+    typedef ImageContainerByBricks<TDomain, TValue, TLogBrickSize> Self;
+
+    /// domain
+    typedef TDomain Domain;
+    typedef typename Domain::Space Space;
+    BOOST_STATIC_ASSERT(( boost::is_same< Domain, HyperRectDomain< Space > >::value ));
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Integer Integer;
+    typedef typename Domain::Size Size;
+    typedef typename Domain::Dimension Dimension;
+    typedef Point Vertex;
+
+    // Pointer to the (const) Domain given at construction.
+    typedef CowPtr< const Domain >  DomainPtr;
+
+    /// static constants
+    static const Dimension dimension = Space::dimension;
+    /// Side of the bricks.
+    static constexpr Integer brickSize = Integer( 1 ) << TLogBrickSize;
+    /// Number of values of a brick.
+    static constexpr Size brickVolume = Size( 1 ) << ( TLogBrickSize * dimension );
+
+    /// range of values
+    typedef TValue Value;
+    typedef DefaultConstImageRange<Self> ConstRange;
+    typedef DefaultImageRange<Self> Range;
+
+    /// output iterator
+    typedef SetValueIterator<Self> OutputIterator;
+
+    /**
+     * Forward iterator on the points of the domain, visiting bricks
+     * in the storage order and the points of each brick in Morton
+     * order.
+     */
+    class BrickOrderConstIterator
+    {
+    public:
+      typedef std::forward_iterator_tag iterator_category;
+      typedef Point value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef const Point* pointer;
+      typedef const Point& reference;
+
+      /// Default constructor (invalid iterator).
+      BrickOrderConstIterator() = default;
+
+      /**
+       * Constructor.
+       * @param anImage the traversed image.
+       * @param aBrick the rank of the first brick to visit.
+       */
+      BrickOrderConstIterator( const Self & anImage, Size aBrick );
+
+      /// @return the current point.
+      reference operator*() const { return myPoint; }
+      /// @return a pointer to the current point.
+      pointer operator->() const { return &myPoint; }
+      /// Moves to the next point of the domain.
+      BrickOrderConstIterator & operator++();
+      /// Moves to the next point of the domain.
+      BrickOrderConstIterator operator++( int );
+      /// @return the rank of the current brick.
+      Size brick() const { return myBrick; }
+      /// @return the rank of the current point in its brick.
+      Size offset() const { return myOffset; }
+
+      /// Equality operator.
+      bool operator==( const BrickOrderConstIterator & other ) const
+      { return ( myBrick == other.myBrick ) && ( myOffset == other.myOffset ); }
+      /// Inequality operator.
+      bool operator!=( const BrickOrderConstIterator & other ) const
+      { return ! ( *this == other ); }
+
+    private:
+      /// Updates the current point or moves to the next one until
+      /// it is in the domain.
+      void skipOutside();
+
+      /// Traversed image.
+      const Self* myImage = nullptr;
+      /// Rank of the current brick.
+      Size myBrick = 0;
+      /// Rank of the current point in its brick.
+      Size myOffset = 0;
+      /// Current point.
+      Point myPoint;
+    };
+
+    /////////////////// standard services //////////////////
+
+  public:
+
+    /**
+     * Constructor of an image whose values are all equal.
+     *
+     * @param aDomain the image domain.
+     * @param aValue the value of every point.
+     */
+    ImageContainerByBricks( Clone<const Domain> aDomain,
+                            const Value & aValue = Value() );
+
+    /**
+     * Copy constructor.
+     * @param other the object to copy.
+     */
+    ImageContainerByBricks( const Self & other ) = default;
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    Self & operator=( const Self & other ) = default;
+
+    /**
+     * Destructor.
+     */
+    ~ImageContainerByBricks() = default;
+
+    /////////////////// Interface //////////////////
+
+    /**
+     * Get the value of the image at a given point.
+     *
+     * @pre @a aPoint must be a point in the image domain.
+     *
+     * @param aPoint the point.
+     * @return the value at aPoint.
+     */
+    Value operator()( const Point & aPoint ) const;
+
+    /**
+     * Set the value of the image at a given point.
+     *
+     * @pre @a aPoint must be a point in the image domain.
+     *
+     * @param aPoint the point.
+     * @param aValue the value.
+     */
+    void setValue( const Point & aPoint, const Value & aValue );
+
+    /**
+     * @return the domain associated to the image.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return the const range providing constant
+     * iterators to iterate over the values of the image.
+     */
+    ConstRange constRange() const;
+
+    /**
+     * @return the range providing constant iterators
+     * and output iterators on the values of the image.
+     */
+    Range range();
+
+    /**
+     * @return an output iterator on the image.
+     */
+    OutputIterator outputIterator();
+
+    /**
+     * @return an iterator on the first point of the domain in brick order.
+     */
+    BrickOrderConstIterator brickOrderBegin() const;
+
+    /**
+     * @return an iterator after the last point of the domain in brick order.
+     */
+    BrickOrderConstIterator brickOrderEnd() const;
+
+    // ----------------------- Brick services -------------------------------
+
+    /**
+     * @return the number of bricks.
+     */
+    Size nbBricks() const;
+
+    /**
+     * @return the number of uniform bricks.
+     */
+    Size nbUniformBricks() const;
+
+    /**
+     * @param aBrick the rank of a brick in the storage order.
+     * @return 'true' if the brick only stores one value.
+     */
+    bool isUniform( Size aBrick ) const;
+
+    /**
+     * @param aBrick the rank of a brick in the storage order.
+     * @return the lowest point of the brick, which may lie outside
+     * the domain for the last bricks along each axis.
+     */
+    const Point & brickLowerBound( Size aBrick ) const;
+
+    /**
+     * @param aBrick the rank of a brick in the storage order.
+     * @param anOffset the rank of a point in the brick.
+     * @return the point.
+     */
+    Point point( Size aBrick, Size anOffset ) const;
+
+    /**
+     * @param aBrick the rank of a brick in the storage order.
+     * @param anOffset the rank of a point in the brick.
+     * @return the value of the point.
+     */
+    Value value( Size aBrick, Size anOffset ) const;
+
+    /**
+     * Collapses the bricks whose values are all equal, and stores
+     * the values of the bricks contiguously in storage order.
+     * @return the number of collapsed bricks.
+     */
+    Size compress();
+
+    /**
+     * @return an evaluation of the memory usage of the image in bytes.
+     */
+    Size memoryUsage() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Private services ---------------------------
+  private:
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return the row-major index of its brick in the grid of bricks
+     * (first) and its rank in the brick (second).
+     */
+    std::pair<Size, Size> locate( const Point & aPoint ) const;
+
+    /**
+     * @param aPoint a point with non-negative coordinates.
+     * @return the Morton code of @a aPoint, i.e. the interleaving of
+     * the bits of its coordinates.
+     */
+    static DGtal::uint64_t mortonCode( const Point & aPoint );
+
+    /**
+     * Stores the values of the bricks contiguously in storage order,
+     * which removes the former values of expanded bricks.
+     * @param collapse when 'true', the bricks whose values are all
+     * equal are collapsed too.
+     * @return the number of collapsed bricks.
+     */
+    Size pack( bool collapse );
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Shared pointer on the image domain,
+    /// Since the domain is not mutable, not assignable,
+    /// it is shared by all the copies of *this
+    DomainPtr myDomainPtr;
+
+    /// Lowest point of the domain.
+    Point myLower;
+
+    /// Number of bricks along each axis.
+    Point myGridExtent;
+
+    /// Row-major index in the grid of bricks of each brick, in storage order.
+    std::vector<Size> myOrder;
+
+    /// Lowest point of each brick, in storage order.
+    std::vector<Point> myLowerBounds;
+
+    /// Values of a brick in myValues: the brickVolume values in
+    /// Morton order starting at 'start' with mask brickVolume-1, or
+    /// a single value at 'start' with mask 0 if the brick is uniform.
+    struct Slot
+    {
+      Size start;
+      Size mask;
+    };
+
+    /// Slot of each brick, indexed by its row-major index in the grid of bricks.
+    std::vector<Slot> mySlots;
+
+    /// Values of the bricks.
+    std::vector<Value> myValues;
+
+    /// Number of values of myValues that are not used by any brick.
+    Size myNbFreeValues;
+
+    /// Morton offset of each coordinate along each axis in a brick.
+    std::vector<Size> myOffsets[ dimension ];
+
+    /// For each coordinate along each axis, relative to myLower, its
+    /// contributions to the row-major index of its brick (first) and
+    /// to its Morton offset in the brick (second).
+    std::vector< std::pair<Size, Size> > myTerms[ dimension ];
+
+    /// Position in its brick of the point of each Morton offset.
+    std::vector<Point> myLocalPoints;
+
+  }; // end of class ImageContainerByBricks
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageContainerByBricks'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageContainerByBricks' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain, typename TValue, unsigned int TLogBrickSize>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const ImageContainerByBricks<TDomain, TValue, TLogBrickSize> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageContainerByBricks.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageContainerByBricks_h
+
+#undef ImageContainerByBricks_RECURSES
+#endif // else defined(ImageContainerByBricks_RECURSES)
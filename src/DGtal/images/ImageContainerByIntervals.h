@@ -0,0 +1,376 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageContainerByIntervals.h
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module ImageContainerByIntervals.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageContainerByIntervals_RECURSES)
+#error Recursive header files inclusion detected in ImageContainerByIntervals.h
+#else // defined(ImageContainerByIntervals_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageContainerByIntervals_RECURSES
+
+#if !defined ImageContainerByIntervals_h
+/** Prevents repeated inclusion of headers. */
+#define ImageContainerByIntervals_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CowPtr.h"
+#include "DGtal/base/Clone.h"
+#include "DGtal/kernel/domains/CDomain.h"
+#include "DGtal/kernel/LatticeSetByIntervals.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+#include "DGtal/images/DefaultImageRange.h"
+#include "DGtal/images/SetValueIterator.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageContainerByIntervals
+  /**
+   * Description of template class 'ImageContainerByIntervals' <p>
+   * \brief Aim: Model of concepts::CImage representing a binary image
+   * as runs of foreground points along the first axis, stored in a
+   * LatticeSetByIntervals.
+   *
+   * Memory is proportional to the number of runs instead of the
+   * number of points of the domain, which makes this container
+   * well suited to large sparse volumes. Random access costs a
+   * logarithmic number of operations in the number of rows and
+   * in the number of runs of the row.
+   *
+   * Besides the usual image services, rows of runs can be traversed
+   * directly (see rowBegin() and rowEnd()) and boolean operations
+   * between images are computed run by run (see add(), subtract(),
+   * intersect() and symmetricSubtract()).
+   *
+   * Since its values are booleans, an object of this class is also a
+   * model of concepts::CPointPredicate and can be given as is, for
+   * instance, to DistanceTransformation or Shortcuts::makeDigitalSurface.
+   *
+   * @tparam TDomain a model of concepts::CDomain, usually an HyperRectDomain.
+   *
+   * @see testImageContainerByIntervals.cpp
+   */
+  template <typename TDomain>
+  class ImageContainerByIntervals
+  {
+  public:
+
+    typedef ImageContainerByIntervals<TDomain> Self;
+
+    /// domain
+    BOOST_CONCEPT_ASSERT(( concepts::CDomain<TDomain> ));
+    typedef TDomain Domain;
+    typedef typename Domain::Space Space;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Integer Integer;
+    typedef typename Domain::Size Size;
+    typedef typename Domain::Dimension Dimension;
+    typedef Point Vertex;
+
+    // Pointer to the (const) Domain given at construction.
+    typedef CowPtr< const Domain >  DomainPtr;
+
+    /// static constants
+    static const Dimension dimension = Space::dimension;
+
+    /// range of values
+    typedef bool Value;
+    typedef DefaultConstImageRange<Self> ConstRange;
+    typedef DefaultImageRange<Self> Range;
+
+    /// output iterator
+    typedef SetValueIterator<Self> OutputIterator;
+
+    /// Runs storage
+    typedef LatticeSetByIntervals<Space> Container;
+    typedef typename Container::Intervals Intervals;
+    typedef typename Container::Interval Interval;
+    /// Iterator on rows: pairs (row point with null first coordinate, runs).
+    typedef typename Container::Container::const_iterator RowConstIterator;
+
+    /////////////////// standard services //////////////////
+
+  public:
+
+    /**
+     * Constructor of an empty image (every value is false).
+     *
+     * @param aDomain the image domain.
+     */
+    ImageContainerByIntervals( Clone<const Domain> aDomain );
+
+    /**
+     * Constructor from a point predicate, e.g. a dense binary image,
+     * a thresholded image or a digitized shape. The runs are built
+     * row by row, each point of the domain is evaluated once.
+     *
+     * @tparam TPointPredicate any model of concepts::CPointPredicate.
+     * @param aDomain the image domain.
+     * @param aPredicate the predicate giving the foreground points.
+     */
+    template <typename TPointPredicate>
+    ImageContainerByIntervals( Clone<const Domain> aDomain,
+                               const TPointPredicate & aPredicate );
+
+    /**
+     * Copy constructor.
+     * @param other the object to copy.
+     */
+    ImageContainerByIntervals( const Self & other ) = default;
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    Self & operator=( const Self & other ) = default;
+
+    /**
+     * Destructor.
+     */
+    ~ImageContainerByIntervals() = default;
+
+    /////////////////// Interface //////////////////
+
+    /**
+     * Get the value of the image at a given point.
+     *
+     * @param aPoint the point.
+     * @return the value at aPoint ('false' outside the domain).
+     */
+    Value operator()( const Point & aPoint ) const;
+
+    /**
+     * Set the value of the image at a given point.
+     *
+     * @pre @a aPoint must be a point in the image domain.
+     *
+     * @param aPoint the point.
+     * @param aValue the value.
+     */
+    void setValue( const Point & aPoint, const Value & aValue );
+
+    /**
+     * @return the domain associated to the image.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return the const range providing constant
+     * iterators to iterate over the values of the image.
+     */
+    ConstRange constRange() const;
+
+    /**
+     * @return the range providing constant iterators
+     * and output iterators on the values of the image.
+     */
+    Range range();
+
+    /**
+     * @return an output iterator on the image.
+     */
+    OutputIterator outputIterator();
+
+    /**
+     * Replaces the runs of foreground points of a row.
+     *
+     * @param aPoint any point of the row (its first coordinate is ignored).
+     * @param aRuns the runs of the row, sorted, disjoint, non adjacent
+     * and within the domain (empty to clear the row).
+     */
+    void setRow( Point aPoint, const std::vector<Interval> & aRuns );
+
+    /**
+     * Computes the runs of foreground points of a row from the values
+     * of its points, e.g. to build rows in parallel before setting
+     * them with setRow.
+     *
+     * @tparam TIterator an iterator on values convertible to bool.
+     * @param itValues an iterator on the value of the first point of the row.
+     * @param aFirst the first coordinate of the first point of the row.
+     * @param aLast the first coordinate of the last point of the row.
+     * @param[out] aRuns the runs of the row (previous runs are removed).
+     */
+    template <typename TIterator>
+    static void rowRuns( TIterator itValues, Integer aFirst, Integer aLast,
+                         std::vector<Interval> & aRuns );
+
+    /**
+     * @return a const reference to the underlying lattice set.
+     */
+    const Container & container() const;
+
+    /**
+     * @return an iterator on the first non-empty row.
+     */
+    RowConstIterator rowBegin() const;
+
+    /**
+     * @return an iterator after the last non-empty row.
+     */
+    RowConstIterator rowEnd() const;
+
+    /**
+     * @return the number of foreground points.
+     */
+    Size size() const;
+
+    /**
+     * @return the number of runs of foreground points.
+     */
+    Size nbRuns() const;
+
+    /**
+     * @return an evaluation of the memory usage of the image in bytes.
+     */
+    Size memoryUsage() const;
+
+    // ----------------------- Boolean operations ---------------------------
+
+    /**
+     * Union with another image sharing the same domain.
+     * @param other any image.
+     * @return a reference on 'this'.
+     */
+    Self & add( const Self & other );
+
+    /**
+     * Difference with another image sharing the same domain.
+     * @param other any image.
+     * @return a reference on 'this'.
+     */
+    Self & subtract( const Self & other );
+
+    /**
+     * Intersection with another image sharing the same domain.
+     * @param other any image.
+     * @return a reference on 'this'.
+     */
+    Self & intersect( const Self & other );
+
+    /**
+     * Symmetric difference with another image sharing the same domain.
+     * @param other any image.
+     * @return a reference on 'this'.
+     */
+    Self & symmetricSubtract( const Self & other );
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object: runs are sorted,
+     * disjoint, non adjacent and within the domain.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Private services ---------------------------
+  private:
+
+    /**
+     * Combines row by row the runs of 'this' and of @a other with a
+     * sweep over the sorted interval bounds.
+     *
+     * @tparam TBooleanOperator the type of @a op.
+     * @param other any image.
+     * @param op a function (bool, bool) -> bool.
+     * @param keepAlone when 'true', rows of 'this' without
+     * counterpart in @a other are kept, otherwise they are removed.
+     * @param addAlone when 'true', rows of @a other without
+     * counterpart in 'this' are added.
+     */
+    template <typename TBooleanOperator>
+    void combine( const Self & other, TBooleanOperator op,
+                  bool keepAlone, bool addAlone );
+
+    /**
+     * Sweep of two sequences of runs.
+     *
+     * @param A,B two sequences of runs.
+     * @param op a function (bool, bool) -> bool.
+     * @return the runs of the points x such that op( x in A, x in B ).
+     */
+    template <typename TBooleanOperator>
+    static Intervals combine( const Intervals & A, const Intervals & B,
+                              TBooleanOperator op );
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Shared pointer on the image domain,
+    /// Since the domain is not mutable, not assignable,
+    /// it is shared by all the copies of *this
+    DomainPtr myDomainPtr;
+
+    /// The runs of foreground points along axis 0.
+    Container myData;
+
+  }; // end of class ImageContainerByIntervals
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageContainerByIntervals'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageContainerByIntervals' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain>
+  std::ostream&
+  operator<< ( std::ostream & out, const ImageContainerByIntervals<TDomain> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageContainerByIntervals.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageContainerByIntervals_h
+
+#undef ImageContainerByIntervals_RECURSES
+#endif // else defined(ImageContainerByIntervals_RECURSES)
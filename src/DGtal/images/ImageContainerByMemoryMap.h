@@ -0,0 +1,335 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageContainerByMemoryMap.h
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module ImageContainerByMemoryMap.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageContainerByMemoryMap_RECURSES)
+#error Recursive header files inclusion detected in ImageContainerByMemoryMap.h
+#else // defined(ImageContainerByMemoryMap_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageContainerByMemoryMap_RECURSES
+
+#if !defined ImageContainerByMemoryMap_h
+/** Prevents repeated inclusion of headers. */
+#define ImageContainerByMemoryMap_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <memory>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+#include "DGtal/images/DefaultImageRange.h"
+#include "DGtal/images/SetValueIterator.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageContainerByMemoryMap
+  /**
+   * Description of template class 'ImageContainerByMemoryMap' <p>
+   * \brief Aim: Model of concepts::CImage whose values are read (and
+   * written) directly in a file mapped in memory, for instance the
+   * payload of an uncompressed Vol, Longvol, Raw or binary PGM file.
+   *
+   * Mapping a file costs nothing more than parsing its header: pages
+   * are loaded by the operating system when voxels are accessed and
+   * can be evicted when memory is short, so that volumes larger than
+   * the physical memory can be processed. Values are never copied in
+   * a separate buffer.
+   *
+   * Values are stored in the file at @a offset, in the order of the
+   * domain (first coordinate varying fastest), with the byte order of
+   * the machine, as written by VolWriter, LongvolWriter or RawWriter.
+   * They may be unaligned in memory (e.g. after a text header) and are
+   * thus accessed by copy.
+   *
+   * A read-only map models concepts::CConstImage. A writable map
+   * (opened with @a writable set to true) also models concepts::CImage:
+   * setValue() modifies the file itself, which is updated at the
+   * latest when the last copy of the image is destroyed (see also
+   * flush()).
+   *
+   * Copies of an image share the same map (shallow copy), as for
+   * ArrayImageAdapter.
+   *
+   * Maps are usually obtained from the readers, see
+   * VolReader::mapVol, LongvolReader::mapLongvol, RawReader::mapRaw,
+   * PGMReader::mapPGM, PGMReader::mapPGM3D, or GenericReader when its
+   * container is an ImageContainerByMemoryMap.
+   *
+   * @code
+   * typedef ImageContainerByMemoryMap< Z3i::Domain, unsigned char > MappedImage;
+   * MappedImage image = VolReader< MappedImage >::mapVol( "lobster.vol" );
+   * trace.info() << image( Z3i::Point( 10, 20, 30 ) ) << std::endl;
+   * @endcode
+   *
+   * @tparam TDomain an HyperRectDomain.
+   * @tparam TValue a trivially copyable value type.
+   *
+   * @see testImageContainerByMemoryMap.cpp
+   */
+  template <typename TDomain, typename TValue>
+  class ImageContainerByMemoryMap
+  {
+  public:
+
+    typedef ImageContainerByMemoryMap<TDomain, TValue> Self;
+
+    /// domain
+    BOOST_CONCEPT_ASSERT(( concepts::CDomain<TDomain> ));
+    typedef TDomain Domain;
+    typedef typename Domain::Space Space;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Integer Integer;
+    typedef typename Domain::Size Size;
+    typedef typename Domain::Dimension Dimension;
+    typedef Point Vertex;
+
+    BOOST_STATIC_ASSERT(( std::is_same< Domain, HyperRectDomain<Space> >::value ));
+
+    /// static constants
+    static const Dimension dimension = Space::dimension;
+
+    /// range of values
+    typedef TValue Value;
+    BOOST_STATIC_ASSERT(( std::is_trivially_copyable<Value>::value ));
+    typedef DefaultConstImageRange<Self> ConstRange;
+    typedef DefaultImageRange<Self> Range;
+
+    /// output iterator
+    typedef SetValueIterator<Self> OutputIterator;
+
+    /////////////////// standard services //////////////////
+
+  public:
+
+    /**
+     * Constructor. Maps the values of @a aDomain stored in file @a
+     * filename from byte @a offset.
+     *
+     * @param filename the name of the file.
+     * @param aDomain the image domain.
+     * @param offset the position of the first value in the file, in bytes.
+     * @param writable when 'true', the file is opened for reading and
+     * writing and setValue() modifies it, otherwise the image is read-only.
+     *
+     * @throw IOException if the file cannot be mapped or is too short.
+     */
+    ImageContainerByMemoryMap( const std::string & filename,
+                               const Domain & aDomain,
+                               std::size_t offset = 0,
+                               bool writable = false );
+
+    /**
+     * Copy constructor. The copy shares the map of @a other.
+     * @param other the object to copy.
+     */
+    ImageContainerByMemoryMap( const Self & other ) = default;
+
+    /**
+     * Assignment. 'this' shares the map of @a other.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    Self & operator=( const Self & other ) = default;
+
+    /**
+     * Destructor. The file is unmapped with the last copy.
+     */
+    ~ImageContainerByMemoryMap() = default;
+
+    /////////////////// Interface //////////////////
+
+    /**
+     * Get the value of the image at a given point.
+     *
+     * @pre @a aPoint must be a point in the image domain.
+     *
+     * @param aPoint the point.
+     * @return the value at aPoint.
+     */
+    Value operator()( const Point & aPoint ) const;
+
+    /**
+     * Set the value of the image at a given point.
+     *
+     * @pre the image is writable and @a aPoint is a point in the image domain.
+     *
+     * @param aPoint the point.
+     * @param aValue the value.
+     */
+    void setValue( const Point & aPoint, const Value & aValue );
+
+    /**
+     * @return the domain associated to the image.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return the const range providing constant
+     * iterators to iterate over the values of the image.
+     */
+    ConstRange constRange() const;
+
+    /**
+     * @return the range providing constant iterators
+     * and output iterators on the values of the image.
+     */
+    Range range();
+
+    /**
+     * @return an output iterator on the image.
+     */
+    OutputIterator outputIterator();
+
+    /**
+     * Reverses the order of the values along an axis, e.g. for images
+     * stored from top to bottom. Values are not moved.
+     *
+     * @param k any dimension.
+     */
+    void flip( Dimension k );
+
+    /**
+     * Writes the modified values to the file. This is done anyway
+     * when the file is unmapped.
+     */
+    void flush();
+
+    /**
+     * @return 'true' if setValue() can be used.
+     */
+    bool isWritable() const;
+
+    /**
+     * @return the name of the mapped file.
+     */
+    const std::string & fileName() const;
+
+    /**
+     * @return the position of the first value in the file, in bytes.
+     */
+    std::size_t offset() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Private services ---------------------------
+  private:
+
+    /**
+     * A file mapped in memory, unmapped at destruction.
+     */
+    struct Mapping
+    {
+      /// Maps @a filename in memory, throws IOException on failure.
+      Mapping( const std::string & filename, bool writable );
+      /// Unmaps the file.
+      ~Mapping();
+      Mapping( const Mapping & ) = delete;
+      Mapping & operator=( const Mapping & ) = delete;
+
+      std::string fileName;
+      bool writable;
+      char * address;
+      std::size_t length;
+    };
+
+    /**
+     * @param aPoint any point of the domain.
+     * @return the address of its value in the map.
+     */
+    char * address( const Point & aPoint ) const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The image domain.
+    Domain myDomain;
+
+    /// The map, shared by all the copies of *this.
+    std::shared_ptr<Mapping> myMapping;
+
+    /// The position of the first value in the file, in bytes.
+    std::size_t myOffset;
+
+    /// The index of the value of the lower bound of the domain.
+    std::ptrdiff_t myFirst;
+
+    /// The difference of indices between neighbors along each axis.
+    std::array<std::ptrdiff_t, dimension> myStrides;
+
+  }; // end of class ImageContainerByMemoryMap
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageContainerByMemoryMap'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageContainerByMemoryMap' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain, typename TValue>
+  std::ostream&
+  operator<< ( std::ostream & out, const ImageContainerByMemoryMap<TDomain, TValue> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageContainerByMemoryMap.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageContainerByMemoryMap_h
+
+#undef ImageContainerByMemoryMap_RECURSES
+#endif // else defined(ImageContainerByMemoryMap_RECURSES)
@@ -0,0 +1,242 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageFactoryFromChunkedVol.h
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module ImageFactoryFromChunkedVol.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageFactoryFromChunkedVol_RECURSES)
+#error Recursive header files inclusion detected in ImageFactoryFromChunkedVol.h
+#else // defined(ImageFactoryFromChunkedVol_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageFactoryFromChunkedVol_RECURSES
+
+#if !defined ImageFactoryFromChunkedVol_h
+/** Prevents repeated inclusion of headers. */
+#define ImageFactoryFromChunkedVol_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConceptUtils.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/io/ChunkedVolFormat.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  /////////////////////////////////////////////////////////////////////////////
+  // Template class ImageFactoryFromChunkedVol
+  /**
+   * Description of template class 'ImageFactoryFromChunkedVol' <p>
+   * \brief Aim: implements a factory producing images from a chunked
+   * volume file (see ChunkedVolFormat) according to a given domain.
+   *
+   * Only the chunks intersecting the requested domain are read, and
+   * they are decompressed in parallel. With TiledImage, this gives a
+   * random access to volumes that do not fit in memory:
+   *
+   * @code
+   * typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+   * typedef ImageFactoryFromChunkedVol<Image> Factory;
+   * typedef ImageCacheReadPolicyFIFO<Image, Factory> ReadPolicy;
+   * typedef ImageCacheWritePolicyWB<Image, Factory> WritePolicy;
+   * Factory factory( "labels.cvol" );
+   * ReadPolicy readPolicy( factory, 8 );
+   * WritePolicy writePolicy( factory );
+   * TiledImage<Image, Factory, ReadPolicy, WritePolicy>
+   *   tiled( factory, readPolicy, writePolicy, 4 );
+   * @endcode
+   * Tiles matching the chunks (see nbChunks) avoid decompressing a
+   * chunk for several tiles.
+   *
+   * The factory images production (images are copied, so it's a creation process) is done with the function 'requestImage'
+   * so the deletion must be done with the function 'detachImage'.
+   *
+   * Chunked volumes are read-only: 'flushImage' does nothing.
+   *
+   * @tparam TImageContainer an image container type (model of CImage)
+   * whose values have the Value-Size of the file.
+   *
+   * @see testChunkedVol.cpp
+   */
+  template <typename TImageContainer>
+  class ImageFactoryFromChunkedVol
+  {
+
+    // ----------------------- Types ------------------------------
+
+  public:
+    typedef ImageFactoryFromChunkedVol<TImageContainer> Self;
+
+    ///Checking concepts
+    BOOST_CONCEPT_ASSERT(( concepts::CImage<TImageContainer> ));
+
+    ///Types copied from the container
+    typedef TImageContainer ImageContainer;
+    typedef typename ImageContainer::Domain Domain;
+
+    ///New types
+    typedef ImageContainer OutputImage;
+    typedef typename OutputImage::Value Value;
+
+    typedef ChunkedVolFormat Format;
+
+    BOOST_STATIC_ASSERT(Domain::dimension == 3);
+
+    // ----------------------- Standard services ------------------------------
+
+  public:
+
+    /**
+     * Constructor. Reads the header and the chunk index of the file.
+     *
+     * @param aFilename the chunked volume filename.
+     * @throw IOException if the file can't be read or if its values
+     * don't have the size of Value.
+     */
+    ImageFactoryFromChunkedVol( const std::string & aFilename );
+
+    ImageFactoryFromChunkedVol( const ImageFactoryFromChunkedVol & other ) = delete;
+    ImageFactoryFromChunkedVol & operator=( const ImageFactoryFromChunkedVol & other ) = delete;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /////////////////// Domains //////////////////
+
+    /**
+     * Returns a reference to the underlying image domain.
+     *
+     * @return a reference to the domain.
+     */
+    const Domain & domain() const
+    {
+      return myDomain;
+    }
+
+    /**
+     * @return the number of chunks along each axis, e.g. a number of
+     * tiles for TiledImage.
+     */
+    typename Domain::Point nbChunks() const;
+
+    /////////////////// API //////////////////
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const
+    {
+      return myDomain.isValid() && myIndex.size() == myHeader.size();
+    }
+
+    /**
+     * Returns a pointer of an OutputImage created with the Domain
+     * aDomain. Only the chunks intersecting aDomain are decompressed.
+     *
+     * @param aDomain the domain, included in domain().
+     *
+     * @return an ImagePtr.
+     */
+    OutputImage * requestImage( const Domain & aDomain );
+
+    /**
+     * Flush (i.e. write/synchronize) an OutputImage. Chunked volumes
+     * are read-only, so modifications of the image are not kept.
+     *
+     * @param outputImage the OutputImage.
+     */
+    void flushImage( OutputImage* outputImage )
+    {
+      boost::ignore_unused_variable_warning( outputImage );
+    }
+
+    /**
+     * Free (i.e. delete) an OutputImage.
+     *
+     * @param outputImage the OutputImage.
+     */
+    void detachImage( OutputImage* outputImage )
+    {
+      delete outputImage;
+    }
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The chunked volume filename.
+    std::string myFilename;
+
+    /// The chunked volume file.
+    std::ifstream myStream;
+
+    /// The header of the file.
+    Format::Header myHeader;
+
+    /// The chunk index of the file.
+    std::vector<Format::IndexEntry> myIndex;
+
+    /// The image domain.
+    Domain myDomain;
+
+  }; // end of class ImageFactoryFromChunkedVol
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageFactoryFromChunkedVol'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageFactoryFromChunkedVol' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImageContainer>
+  std::ostream&
+  operator<< ( std::ostream & out, const ImageFactoryFromChunkedVol<TImageContainer> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageFactoryFromChunkedVol.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageFactoryFromChunkedVol_h
+
+#undef ImageFactoryFromChunkedVol_RECURSES
+#endif // else defined(ImageFactoryFromChunkedVol_RECURSES)
@@ -0,0 +1,266 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file RigidTransformationResampler.h
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module RigidTransformationResampler.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(RigidTransformationResampler_RECURSES)
+#error Recursive header files inclusion detected in RigidTransformationResampler.h
+#else // defined(RigidTransformationResampler_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define RigidTransformationResampler_RECURSES
+
+#if !defined RigidTransformationResampler_h
+/** Prevents repeated inclusion of headers. */
+#define RigidTransformationResampler_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/base/ThreadPool.h"
+#include "DGtal/kernel/CSpace.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/CConstImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/RigidTransformation2D.h"
+#include "DGtal/images/RigidTransformation3D.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class RigidTransformationResampler
+  /**
+   * Description of template class 'RigidTransformationResampler' <p>
+   * \brief Aim: Resamples 2D or 3D images by a rigid transformation,
+   * i.e. computes the image of the backward (Eulerian) model of
+   * functors::BackwardRigidTransformation2D and
+   * functors::BackwardRigidTransformation3D, with nearest neighbor or
+   * (bi/tri)linear interpolation.
+   *
+   * Instead of evaluating the backward transformation at each point
+   * through a ConstImageAdapter, the transformation is stored as an
+   * affine map and the source coordinates of the points of an output
+   * row are obtained by adding multiples of the image of the first
+   * axis. Rows of the output image are processed in parallel on the
+   * default ThreadPool, and read directly the values of the input
+   * image when it is an ImageContainerBySTLVector.
+   *
+   * Points whose source lies outside the input domain receive a
+   * background value. With linear interpolation, the neighbors of the
+   * source lying outside the input domain count as background, and
+   * values that are not arithmetic are interpolated as nearest
+   * neighbors. Output images of booleans, whose values are packed,
+   * are filled by a single thread.
+   *
+   * @code
+   * typedef RigidTransformationResampler< Z3i::Space > Resampler;
+   * Resampler resampler( RealPoint( 5, 5, 5 ), RealVector( 1, 0, 1 ), M_PI_4,
+   *                      RealVector( 3, -3, 3 ) );
+   * auto transformed = resampler( image, Resampler::LINEAR );
+   * @endcode
+   *
+   * @tparam TSpace a 2 or 3 dimensional digital space.
+   *
+   * @see testRigidTransformationResampler.cpp
+   */
+  template <typename TSpace>
+  class RigidTransformationResampler
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CSpace<TSpace> ));
+    BOOST_STATIC_ASSERT(( TSpace::dimension == 2 || TSpace::dimension == 3 ));
+
+    // ----------------------- Types ------------------------------
+  public:
+    typedef RigidTransformationResampler<TSpace> Self;
+    typedef TSpace Space;
+    typedef HyperRectDomain<Space> Domain;
+    typedef typename Space::Point Point;
+    typedef typename Space::RealPoint RealPoint;
+    typedef typename Space::RealVector RealVector;
+    typedef typename Space::Dimension Dimension;
+    typedef typename Space::Size Size;
+    static const Dimension dimension = Space::dimension;
+
+    /// Interpolation of the values of the input image.
+    enum Interpolation { NEAREST, LINEAR };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor of a 2D rigid transformation.
+     * @param aOrigin  the center of rotation.
+     * @param angle  the angle given in radians.
+     * @param aTranslate  the translation.
+     */
+    RigidTransformationResampler( const RealPoint & aOrigin, double angle,
+                                  const RealVector & aTranslate );
+
+    /**
+     * Constructor of a 3D rigid transformation.
+     * @param aOrigin  the center of rotation.
+     * @param aAxis  the axis of rotation.
+     * @param angle  the angle given in radians.
+     * @param aTranslate  the translation.
+     */
+    RigidTransformationResampler( const RealPoint & aOrigin, const RealVector & aAxis,
+                                  double angle, const RealVector & aTranslate );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @param aPoint any point of the output image.
+     * @return the point of the input image it comes from.
+     */
+    RealPoint source( const Point & aPoint ) const;
+
+    /**
+     * @param aDomain the domain of an input image.
+     * @return the bounding domain of its transformation, as computed by
+     * DomainRigidTransformation2D or DomainRigidTransformation3D.
+     */
+    Domain transformedDomain( const Domain & aDomain ) const;
+
+    /**
+     * Resamples an image on the bounding domain of its transformation.
+     *
+     * @tparam TImage any model of concepts::CConstImage on a Domain.
+     * @param anImage the input image.
+     * @param anInterpolation the interpolation of the input values.
+     * @param aBackground the value of the points whose source is outside
+     * the input domain.
+     * @return the transformed image.
+     */
+    template <typename TImage>
+    ImageContainerBySTLVector<Domain, typename TImage::Value>
+    operator()( const TImage & anImage, Interpolation anInterpolation = NEAREST,
+                const typename TImage::Value & aBackground = typename TImage::Value() ) const;
+
+    /**
+     * Resamples an image into an image whose domain is given.
+     *
+     * @tparam TImage any model of concepts::CConstImage on a Domain.
+     * @tparam TValue the type of the output values.
+     * @param anImage the input image.
+     * @param[in,out] anOutput the output image, whose domain gives the
+     * resampled points.
+     * @param anInterpolation the interpolation of the input values.
+     * @param aBackground the value of the points whose source is outside
+     * the input domain.
+     */
+    template <typename TImage, typename TValue>
+    void resample( const TImage & anImage, ImageContainerBySTLVector<Domain, TValue> & anOutput,
+                   Interpolation anInterpolation = NEAREST,
+                   const TValue & aBackground = TValue() ) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// Sets the affine map from the images of the origin and of the
+    /// basis vectors by the backward transformation.
+    template <typename TBackwardTransformation>
+    void initAffineMap( const TBackwardTransformation & aBackward );
+
+    /**
+     * Resamples one row of the output image.
+     *
+     * @param aSample a function returning the value of the input
+     * image at a point of its domain.
+     * @param aDomain the domain of the input image.
+     * @param aFirst the first point of the row.
+     * @param aLength the number of points of the row.
+     * @param anInterpolation the interpolation of the input values.
+     * @param aBackground the value of the points whose source is outside
+     * the input domain.
+     * @param aWrite a function called with the rank of each point of
+     * the row and its value.
+     */
+    template <typename TSample, typename TValue, typename TWrite>
+    void resampleRow( const TSample & aSample, const Domain & aDomain,
+                      const Point & aFirst, Size aLength,
+                      Interpolation anInterpolation, const TValue & aBackground,
+                      const TWrite & aWrite ) const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Source of the origin of the output space.
+    RealPoint myOffset;
+    /// Source displacement along each axis of the output space.
+    RealVector myColumns[ dimension ];
+    /// Center of rotation.
+    RealPoint myOrigin;
+    /// Axis of rotation (3D).
+    RealVector myAxis;
+    /// Angle of rotation.
+    double myAngle;
+    /// Translation.
+    RealVector myTranslate;
+
+  }; // end of class RigidTransformationResampler
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'RigidTransformationResampler'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'RigidTransformationResampler' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const RigidTransformationResampler<TSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/RigidTransformationResampler.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined RigidTransformationResampler_h
+
+#undef RigidTransformationResampler_RECURSES
+#endif // else defined(RigidTransformationResampler_RECURSES)
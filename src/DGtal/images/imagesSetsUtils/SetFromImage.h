@@ -45,6 +45,8 @@
 #include "DGtal/images/CImage.h"
 #include "DGtal/kernel/sets/CDigitalSet.h"
 #include "DGtal/images/IntervalForegroundPredicate.h"
+#include "DGtal/images/ImageContainerByIntervals.h"
+#include "DGtal/images/ImageContainerByBricks.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -151,6 +153,34 @@ namespace DGtal
       append(aSet,aImage,isForeground);
     }
 
+    /** 
+     * Append the foreground points of a binary image stored by runs
+     * to an existing Set (maybe empty). Only the runs are traversed,
+     * the background of the domain is never scanned.
+     *
+     * @param aSet the set (maybe empty) to which points are added.
+     * @param aImage image to convert to a Set.
+     */
+    template<typename TDomain>
+    static
+    void append(Set &aSet, const ImageContainerByIntervals<TDomain> &aImage);
+
+    /** 
+     * Append the points of a bricked image whose values lie in ]minVal,maxVal]
+     * to an existing Set (maybe empty). Points are visited in brick
+     * order, and the value of a uniform brick is tested once.
+     *
+     * @param aSet the set (maybe empty) to which points are added.
+     * @param aImage image to convert to a Set.
+     * @param minVal minimum value of the thresholding
+     * @param maxVal maximum value of the thresholding
+     */
+    template<typename TDomain, typename TValue, unsigned int TLogBrickSize>
+    static
+    void append(Set &aSet,
+                const ImageContainerByBricks<TDomain, TValue, TLogBrickSize> &aImage,
+                const TValue minVal, const TValue maxVal);
+
   };
 } // namespace DGtal
 
@@ -0,0 +1,250 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ChunkedVolFormat.h
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module ChunkedVolFormat.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ChunkedVolFormat_RECURSES)
+#error Recursive header files inclusion detected in ChunkedVolFormat.h
+#else // defined(ChunkedVolFormat_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ChunkedVolFormat_RECURSES
+
+#if !defined ChunkedVolFormat_h
+/** Prevents repeated inclusion of headers. */
+#define ChunkedVolFormat_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // struct ChunkedVolFormat
+  /**
+   * Description of struct 'ChunkedVolFormat' <p>
+   * \brief Aim: Services shared by ChunkedVolReader, ChunkedVolWriter
+   * and ImageFactoryFromChunkedVol to read and write the "cvol"
+   * chunked volume format.
+   *
+   * A cvol file stores a 3D image cut into chunks (boxes of the same
+   * size, except along the upper faces of the domain), each chunk
+   * being compressed independently. It is made of:
+   * - a text header, in the style of the Vol format, ending with a
+   *   line ".":
+   * @verbatim
+   Chunked-Vol-Version: 1
+   Lower-X: 0
+   Lower-Y: 0
+   Lower-Z: 0
+   Upper-X: 255
+   Upper-Y: 255
+   Upper-Z: 99
+   Chunk-X: 64
+   Chunk-Y: 64
+   Chunk-Z: 64
+   Value-Size: 1
+   Compression: zlib
+   .
+   @endverbatim
+   * - the chunk index, i.e. for each chunk its position in the file
+   *   and its compressed size, as two 64 bits integers;
+   * - the compressed chunks.
+   *
+   * Chunks are numbered along X first, then Y, then Z, and their
+   * values are stored in the same order, with the byte order of the
+   * machine (as in Vol and Longvol files). Chunks can thus be read
+   * and decompressed independently, in parallel, or only when a part
+   * of the image is requested (see ImageFactoryFromChunkedVol).
+   *
+   * Compression uses zlib (Compression: zlib), which is a dependency
+   * of DGtal, or no compression (Compression: none). The codec is
+   * named in the header so that other codecs can be added without
+   * changing the layout.
+   *
+   * @see testChunkedVol.cpp
+   */
+  struct ChunkedVolFormat
+  {
+    typedef Z3i::Domain Domain;
+    typedef Z3i::Point Point;
+    typedef Z3i::Integer Integer;
+
+    /// Compression of the chunks.
+    enum Codec { NONE, ZLIB };
+
+    /// Position and compressed size, in bytes, of a chunk in the file.
+    struct IndexEntry
+    {
+      DGtal::uint64_t offset;
+      DGtal::uint64_t size;
+    };
+
+    /// Description of a chunked volume given by the header of the file.
+    struct Header
+    {
+      /// The image domain.
+      Domain domain;
+      /// The size of the chunks along each axis.
+      Point chunkSize;
+      /// The size of a value in bytes.
+      unsigned int valueSize;
+      /// The compression of the chunks.
+      Codec codec;
+      /// The position of the chunk index in the file.
+      std::size_t indexOffset;
+
+      /// @return the number of chunks along each axis.
+      Point nbChunks() const;
+
+      /// @return the total number of chunks.
+      std::size_t size() const;
+
+      /// @param i the index of a chunk.
+      /// @return the domain of chunk @a i.
+      Domain chunkDomain( std::size_t i ) const;
+
+      /// @param aPoint any point of the domain.
+      /// @return the index of the chunk containing @a aPoint.
+      std::size_t chunkIndex( const Point & aPoint ) const;
+    };
+
+    /**
+     * Writes the header of a chunked volume.
+     *
+     * @param out the output stream, positioned at the beginning of the file.
+     * @param header the header, whose indexOffset is set to the position
+     * of the chunk index, i.e. after the header.
+     */
+    static void writeHeader( std::ostream & out, Header & header );
+
+    /**
+     * Reads the header of a chunked volume.
+     *
+     * @param in the input stream, positioned at the beginning of the file.
+     * @param filename the name of the file, for error messages.
+     * @return the header.
+     * @throw IOException if the header is invalid.
+     */
+    static Header readHeader( std::istream & in, const std::string & filename );
+
+    /**
+     * Reads the chunk index of a chunked volume.
+     *
+     * @param in the input stream.
+     * @param header the header of the file.
+     * @return the position and size of each chunk.
+     * @throw IOException if the index can't be read, or if a chunk
+     * does not lie between the index and the end of the file.
+     */
+    static std::vector<IndexEntry> readIndex( std::istream & in, const Header & header );
+
+    /**
+     * Writes the chunk index of a chunked volume.
+     *
+     * @param out the output stream.
+     * @param header the header of the file.
+     * @param index the position and size of each chunk.
+     */
+    static void writeIndex( std::ostream & out, const Header & header,
+                            const std::vector<IndexEntry> & index );
+
+    /**
+     * Reads and decompresses some chunks. Compressed chunks are read
+     * sequentially, then decompressed in parallel (see
+     * ThreadPool::defaultPool).
+     *
+     * @param in the input stream.
+     * @param header the header of the file.
+     * @param index the chunk index of the file.
+     * @param chunks the indices of the chunks to read.
+     * @param[out] values the values of each chunk of @a chunks, in the
+     * order of its domain (see Header::chunkDomain).
+     * @throw IOException if a chunk can't be read or is corrupted.
+     */
+    static void readChunks( std::istream & in, const Header & header,
+                            const std::vector<IndexEntry> & index,
+                            const std::vector<std::size_t> & chunks,
+                            std::vector< std::vector<char> > & values );
+
+    /**
+     * Compresses a chunk.
+     *
+     * @param codec the compression.
+     * @param level the compression level, from 1 (fastest) to 9 (smallest).
+     * @param data the values of the chunk.
+     * @param size the size of @a data in bytes.
+     * @param[out] result the compressed chunk.
+     * @return 'false' if the compression failed. Nothing is written to
+     * trace, so that chunks can be compressed by worker threads.
+     */
+    static bool compress( Codec codec, int level, const char * data, std::size_t size,
+                          std::vector<char> & result );
+
+    /**
+     * Decompresses a chunk.
+     *
+     * @param codec the compression.
+     * @param data the compressed chunk.
+     * @param size the size of @a data in bytes.
+     * @param[out] result the values of the chunk.
+     * @param resultSize the size of @a result in bytes.
+     * @return 'false' if the chunk is corrupted. Nothing is written to
+     * trace, so that chunks can be decompressed by worker threads.
+     */
+    static bool uncompress( Codec codec, const char * data, std::size_t size,
+                            char * result, std::size_t resultSize );
+
+    /**
+     * @param codec any codec.
+     * @return its name in headers.
+     */
+    static std::string codecName( Codec codec );
+
+  }; // end of struct ChunkedVolFormat
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/ChunkedVolFormat.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ChunkedVolFormat_h
+
+#undef ChunkedVolFormat_RECURSES
+#endif // else defined(ChunkedVolFormat_RECURSES)
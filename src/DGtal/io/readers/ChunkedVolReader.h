@@ -0,0 +1,123 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ChunkedVolReader.h
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module ChunkedVolReader.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ChunkedVolReader_RECURSES)
+#error Recursive header files inclusion detected in ChunkedVolReader.h
+#else // defined(ChunkedVolReader_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ChunkedVolReader_RECURSES
+
+#if !defined ChunkedVolReader_h
+/** Prevents repeated inclusion of headers. */
+#define ChunkedVolReader_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CUnaryFunctor.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/io/ChunkedVolFormat.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ChunkedVolReader
+  /**
+   * Description of template struct 'ChunkedVolReader' <p>
+   * \brief Aim: implements methods to read a chunked volume file
+   * (see ChunkedVolFormat).
+   *
+   * Chunks are read one layer (along Z) at a time and decompressed in
+   * parallel (see ThreadPool::defaultPool) before their values are
+   * copied into the image. To load only a part of a large volume, see
+   * ImageFactoryFromChunkedVol.
+   *
+   * Example usage:
+   * @code
+   * typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+   * Image image = ChunkedVolReader<Image>::importChunkedVol( "labels.cvol" );
+   * @endcode
+   *
+   * @tparam TImageContainer the image container to use.
+   *
+   * @tparam TFunctor the type of functor used in the import (by default set to functors::Cast< TImageContainer::Value>) .
+   * @see testChunkedVol.cpp
+   */
+  template <typename TImageContainer,
+            typename TFunctor = functors::Cast< typename TImageContainer::Value > >
+  struct ChunkedVolReader
+  {
+    // ----------------------- Standard services ------------------------------
+
+    typedef TImageContainer ImageContainer;
+    typedef typename TImageContainer::Value Value;
+    typedef TFunctor Functor;
+    typedef ChunkedVolFormat Format;
+
+    BOOST_STATIC_ASSERT(ImageContainer::Domain::dimension == 3);
+
+    /**
+     * Main method to import a chunked volume into an instance of the
+     * template parameter ImageContainer.
+     *
+     * @tparam Word the type of the values in the file (by default the
+     * type of the image values), whose size must be the Value-Size of
+     * the file.
+     * @param filename the file name to import.
+     * @param aFunctor the functor used to import and cast the source
+     * image values into the type of the image container value (by
+     * default set to functors::Cast < TImageContainer::Value > .
+     *
+     * @return an instance of the ImageContainer.
+     * @throw IOException if the file can't be read or is corrupted.
+     */
+    template <typename Word = Value>
+    static ImageContainer importChunkedVol( const std::string & filename,
+                                            const Functor & aFunctor = Functor() );
+
+  }; // end of class ChunkedVolReader
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/readers/ChunkedVolReader.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ChunkedVolReader_h
+
+#undef ChunkedVolReader_RECURSES
+#endif // else defined(ChunkedVolReader_RECURSES)
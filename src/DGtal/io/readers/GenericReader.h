@@ -85,6 +85,9 @@ namespace DGtal
    Image2D an2Dimage= DGtal::GenericReader<Image2D>::import("example.pgm");
    @endcode
    *
+   * - To map the file in memory instead of copying it, use
+   * MemoryMapReader with an ImageContainerByMemoryMap.
+   *
    * @advanced the file format value type will be cast to
    * TContainer::Value.  For instance, VOL file format deals with
    * "unsigned char" and if the TContainer::Value type is different, you
@@ -48,6 +48,7 @@
 #include <boost/static_assert.hpp>
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/base/CUnaryFunctor.h"
+#include "DGtal/images/ImageContainerByMemoryMap.h"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -95,6 +96,8 @@ namespace DGtal
     typedef TImageContainer ImageContainer;
     typedef typename TImageContainer::Value Value;
     typedef TFunctor Functor;
+    /// Type of the images mapping the values of a Longvol file.
+    typedef ImageContainerByMemoryMap< typename ImageContainer::Domain, DGtal::uint64_t > MappedImage;
     
     BOOST_CONCEPT_ASSERT((  concepts::CUnaryFunctor<TFunctor, DGtal::uint64_t, Value > )) ;
     BOOST_STATIC_ASSERT(ImageContainer::Domain::dimension == 3);
@@ -113,10 +116,40 @@ namespace DGtal
      */
     static ImageContainer importLongvol(const std::string & filename,
                                         const Functor & aFunctor =  Functor());
+
+    /**
+     * Maps the values of an uncompressed (Version 2) Longvol file in
+     * memory instead of copying them: the header is parsed and the
+     * returned image reads its values directly in the file. The
+     * functor of the reader is not used.
+     *
+     * @param filename the file name to map.
+     * @param writable when 'true', the values can be modified and
+     * changes are written to the file.
+     *
+     * @return an image mapping the values of the file.
+     * @throw IOException if the file cannot be mapped, e.g. if it is
+     * compressed (Version 3).
+     */
+    static MappedImage mapLongvol( const std::string & filename,
+                                  bool writable = false );
     
     
     
   private:
+
+    /**
+     * Reads the header of a Longvol file.
+     *
+     * @param fin the file, positioned at its beginning. On exit, it is
+     * positioned on the first value.
+     * @param[out] version the version of the file (3 when compressed).
+     * @param[out] total the number of values of the file (X * Y * Z).
+     *
+     * @return the domain of the image.
+     */
+    static typename ImageContainer::Domain readHeader( FILE * fin, int & version,
+                                                      size_t & total );
     
     /**
      * Generic read word (binary mode) in little-endian mode.
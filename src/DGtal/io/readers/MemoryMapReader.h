@@ -0,0 +1,131 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file MemoryMapReader.h
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module MemoryMapReader.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(MemoryMapReader_RECURSES)
+#error Recursive header files inclusion detected in MemoryMapReader.h
+#else // defined(MemoryMapReader_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define MemoryMapReader_RECURSES
+
+#if !defined MemoryMapReader_h
+/** Prevents repeated inclusion of headers. */
+#define MemoryMapReader_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/images/ImageContainerByMemoryMap.h"
+#include "DGtal/io/readers/VolReader.h"
+#include "DGtal/io/readers/LongvolReader.h"
+#include "DGtal/io/readers/PGMReader.h"
+#include "DGtal/io/readers/RawReader.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class MemoryMapReader
+  /**
+   * Description of template class 'MemoryMapReader' <p>
+   * \brief Aim: Maps an image file in memory, choosing the reader
+   * according to its extension, as GenericReader does for copied
+   * images.
+   *
+   * The image is an ImageContainerByMemoryMap whose value type is the
+   * one of the file: unsigned char for uncompressed vol and binary
+   * pgm/pgm3d files, DGtal::uint64_t for uncompressed longvol files,
+   * and any type for raw files.
+   *
+   @code
+   #include "DGtal/io/readers/MemoryMapReader.h"
+   typedef DGtal::ImageContainerByMemoryMap<DGtal::Z3i::Domain, unsigned char> MappedImage3D;
+   MappedImage3D aMappedImage = DGtal::MemoryMapReader<MappedImage3D>::import("example.vol");
+   @endcode
+   *
+   * @tparam TContainer an ImageContainerByMemoryMap.
+   *
+   * @see GenericReader, ImageContainerByMemoryMap
+   */
+  template <typename TContainer>
+  struct MemoryMapReader
+  {
+    typedef TContainer ImageContainer;
+    typedef typename ImageContainer::Domain Domain;
+    typedef typename ImageContainer::Value Value;
+    BOOST_STATIC_ASSERT(( std::is_same< ImageContainer,
+                          ImageContainerByMemoryMap< Domain, Value > >::value ));
+
+    /**
+     * Maps an image file in memory. For the special format of raw
+     * image, the image size must be given in the parameter dimSpace.
+     *
+     * @param filename the image filename to be mapped.
+     * @param dimSpace a vector containing the n dimensional image size.
+     * @param writable when 'true', the values can be modified and
+     * changes are written to the file.
+     *
+     * @throw IOException if the file can't be mapped with this value type.
+     **/
+    static ImageContainer import( const std::string & filename,
+                                  std::vector<unsigned int> dimSpace = std::vector<unsigned int>(),
+                                  bool writable = false );
+
+    /**
+     * Maps an image file in memory, the image size of the raw format
+     * being given by the parameters x, y and z.
+     *
+     * @param filename the image filename to be mapped.
+     * @param x the size in the x direction.
+     * @param y the size in the y direction.
+     * @param z the size in the z direction.
+     *
+     * @throw IOException if the file can't be mapped with this value type.
+     **/
+    static ImageContainer import( const std::string & filename, unsigned int x,
+                                  unsigned int y = 0, unsigned int z = 0 );
+  };
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/readers/MemoryMapReader.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined MemoryMapReader_h
+
+#undef MemoryMapReader_RECURSES
+#endif // else defined(MemoryMapReader_RECURSES)
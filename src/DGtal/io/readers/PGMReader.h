@@ -43,6 +43,7 @@
 #include <iostream>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CUnaryFunctor.h"
+#include "DGtal/images/ImageContainerByMemoryMap.h"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -104,6 +105,8 @@ struct PGMReader
     typedef typename TImageContainer::Domain::Vector Vector;
 
     typedef TFunctor Functor;
+    /// Type of the images mapping the values of a binary PGM file.
+    typedef ImageContainerByMemoryMap< typename ImageContainer::Domain, unsigned char > MappedImage;
     
     enum MagicNumber {P1,P2,P3,P4,P5,P6};
 
@@ -149,6 +152,49 @@ struct PGMReader
      */
     static ImageContainer importPGM3D(const std::string & aFilename,
 				      const Functor & aFunctor =  Functor());
+
+    /**
+     * Maps the values of a binary (P5) Pgm (8bits) in memory instead
+     * of copying them: the header is parsed and the returned image
+     * reads its values directly in the file. The functor of the
+     * reader is not used.
+     *
+     * @param aFilename the file name to map.
+     * @param writable when 'true', the values can be modified and
+     * changes are written to the file.
+     * @param topbotomOrder if true, the point of coordinate (0,0) is
+     * the bottom left corner of the image (default, as importPGM).
+     * @return an image mapping the values of the file.
+     * @throw IOException if the file cannot be mapped, e.g. if it is
+     * an ASCII (P2) file.
+     */
+    static MappedImage mapPGM(const std::string & aFilename,
+                              bool writable = false,
+                              bool topbotomOrder = true);
+
+    /**
+     * Maps the values of a binary (P5) Pgm3D (8bits) in memory
+     * instead of copying them (see mapPGM).
+     *
+     * @param aFilename the file name to map.
+     * @param writable when 'true', the values can be modified and
+     * changes are written to the file.
+     * @return an image mapping the values of the file.
+     * @throw IOException if the file cannot be mapped.
+     */
+    static MappedImage mapPGM3D(const std::string & aFilename,
+                                bool writable = false);
+
+  private:
+
+    /**
+     * Reads the header of a binary (P5) Pgm or Pgm3D file.
+     *
+     * @param aFilename the file name.
+     * @return the domain of the image and the position of its first value.
+     */
+    static std::pair<typename ImageContainer::Domain, std::size_t>
+    readBinaryHeader(const std::string & aFilename);
     
     
     
@@ -45,6 +45,7 @@
 #include <cstdio>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CUnaryFunctor.h"
+#include "DGtal/images/ImageContainerByMemoryMap.h"
 #include <boost/static_assert.hpp>
 //////////////////////////////////////////////////////////////////////////////
 
@@ -64,6 +65,9 @@ namespace DGtal
    *
    * All these methods return an instance of the template parameter \c TImageContainer. A functor can be specified to convert raw values to image values.
    *
+   * The method \c mapRaw maps the file in memory instead of copying its
+   * values (see ImageContainerByMemoryMap).
+   *
    * Example usage:
    * @code
    * ...
@@ -166,6 +170,25 @@ namespace DGtal
              const Vector & extent,
              const Functor & aFunctor =  Functor());
 
+    /**
+     * Method to map a Raw file in memory instead of copying its
+     * values: the returned image reads its values directly in the
+     * file, with the byte order of the machine.
+     *
+     * @tparam Word read pixel type.
+     * @param filename the file name to map.
+     * @param extent the size of the raw data set.
+     * @param writable when 'true', the values can be modified and
+     * changes are written to the file.
+     * @return an image mapping the values of the file.
+     * @throw IOException if the file cannot be mapped or is too short.
+     */
+    template <typename Word>
+    static ImageContainerByMemoryMap< typename ImageContainer::Domain, Word >
+    mapRaw(const std::string & filename,
+           const Vector & extent,
+           bool writable = false);
+
 
   private:
 
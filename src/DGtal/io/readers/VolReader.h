@@ -46,6 +46,7 @@
 #include <cstdio>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CUnaryFunctor.h"
+#include "DGtal/images/ImageContainerByMemoryMap.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -93,6 +94,8 @@ namespace DGtal
     typedef TImageContainer ImageContainer;
     typedef typename TImageContainer::Value Value;
     typedef TFunctor Functor;
+    /// Type of the images mapping the values of a Vol file.
+    typedef ImageContainerByMemoryMap< typename ImageContainer::Domain, unsigned char > MappedImage;
     
     BOOST_CONCEPT_ASSERT((  concepts::CUnaryFunctor<TFunctor, unsigned char, Value > )) ;    
 
@@ -113,9 +116,39 @@ namespace DGtal
      */
     static ImageContainer importVol(const std::string & filename, 
                                     const Functor & aFunctor =  Functor());
+
+    /**
+     * Maps the values of an uncompressed (Version 2) Vol file in
+     * memory instead of copying them: the header is parsed and the
+     * returned image reads its values directly in the file. The
+     * functor of the reader is not used.
+     *
+     * @param filename the file name to map.
+     * @param writable when 'true', the values can be modified and
+     * changes are written to the file.
+     *
+     * @return an image mapping the values of the file.
+     * @throw IOException if the file cannot be mapped, e.g. if it is
+     * compressed (Version 3).
+     */
+    static MappedImage mapVol( const std::string & filename,
+                                  bool writable = false );
     
   private:
 
+    /**
+     * Reads the header of a Vol file.
+     *
+     * @param fin the file, positioned at its beginning. On exit, it is
+     * positioned on the first value.
+     * @param[out] version the version of the file (3 when compressed).
+     * @param[out] total the number of values of the file (X * Y * Z).
+     *
+     * @return the domain of the image.
+     */
+    static typename ImageContainer::Domain readHeader( FILE * fin, int & version,
+                                                      size_t & total );
+
     typedef unsigned char voxel;
     /**
      * This class help us to associate a field type and his value.
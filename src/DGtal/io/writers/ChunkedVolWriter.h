@@ -0,0 +1,270 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ChunkedVolWriter.h
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module ChunkedVolWriter.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ChunkedVolWriter_RECURSES)
+#error Recursive header files inclusion detected in ChunkedVolWriter.h
+#else // defined(ChunkedVolWriter_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ChunkedVolWriter_RECURSES
+
+#if !defined ChunkedVolWriter_h
+/** Prevents repeated inclusion of headers. */
+#define ChunkedVolWriter_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <type_traits>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CUnaryFunctor.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/io/ChunkedVolFormat.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ChunkedVolStreamWriter
+  /**
+   * Description of template class 'ChunkedVolStreamWriter' <p>
+   * \brief Aim: Writes a 3D image in the chunked volume format (see
+   * ChunkedVolFormat) slice by slice, without holding the whole
+   * image in memory.
+   *
+   * Slices are given in increasing Z order by any function of the
+   * points, for instance an image or a functor computing values on
+   * the fly. They are buffered until a layer of chunks is complete.
+   * The chunks of the layer are then compressed in parallel (see
+   * ThreadPool::defaultPool) and appended to the file. Memory is
+   * thus bounded by one layer of chunks, i.e. `Chunk-Z` slices. The
+   * chunk index is written when the writer is closed.
+   *
+   * @code
+   * ChunkedVolStreamWriter< unsigned char > writer( "labels.cvol", domain );
+   * for ( Z3i::Integer z = domain.lowerBound()[ 2 ]; z <= domain.upperBound()[ 2 ]; ++z )
+   *   writer.writeSlice( [&] ( const Z3i::Point & p ) { return label( p ); } );
+   * writer.close();
+   * @endcode
+   *
+   * @tparam TValue the type of the values, a trivially copyable type.
+   *
+   * @see ChunkedVolWriter, ChunkedVolReader, testChunkedVol.cpp
+   */
+  template <typename TValue>
+  class ChunkedVolStreamWriter
+  {
+  public:
+    typedef TValue Value;
+    BOOST_STATIC_ASSERT(( std::is_trivially_copyable<Value>::value ));
+    typedef ChunkedVolFormat Format;
+    typedef Format::Domain Domain;
+    typedef Format::Point Point;
+    typedef Format::Integer Integer;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Creates the file and writes its header.
+     *
+     * @param filename the name of the output file.
+     * @param aDomain the domain of the image.
+     * @param chunkSize the size of the chunks along each axis.
+     * @param codec the compression of the chunks.
+     * @param level the compression level, from 1 (fastest) to 9 (smallest).
+     *
+     * @throw IOException if the file can't be created.
+     */
+    ChunkedVolStreamWriter( const std::string & filename, const Domain & aDomain,
+                            const Point & chunkSize = Point::diagonal( 64 ),
+                            Format::Codec codec = Format::ZLIB,
+                            int level = 6 );
+
+    /**
+     * Destructor. Closes the file if needed.
+     */
+    ~ChunkedVolStreamWriter();
+
+    ChunkedVolStreamWriter( const ChunkedVolStreamWriter & other ) = delete;
+    ChunkedVolStreamWriter & operator=( const ChunkedVolStreamWriter & other ) = delete;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes the next slice, i.e. the values of the points of the
+     * domain whose Z coordinate is nextSlice().
+     *
+     * @tparam TPointFunctor a function of the points whose values are
+     * convertible to Value, e.g. a 3D image.
+     * @param f the function giving the values of the slice.
+     */
+    template <typename TPointFunctor>
+    void writeSlice( const TPointFunctor & f );
+
+    /**
+     * @return the Z coordinate of the next slice to write.
+     */
+    Integer nextSlice() const;
+
+    /**
+     * Writes the chunk index and closes the file. All the slices must
+     * have been written.
+     *
+     * @throw IOException if some slices are missing.
+     */
+    void close();
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// Compresses and writes the chunks of the buffered slices.
+    void flushSlices();
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The output file.
+    std::ofstream myStream;
+
+    /// The name of the output file.
+    std::string myFilename;
+
+    /// The header of the file.
+    Format::Header myHeader;
+
+    /// The compression level.
+    int myLevel;
+
+    /// The position and size of each chunk.
+    std::vector<Format::IndexEntry> myIndex;
+
+    /// The buffered slices of the current layer of chunks.
+    std::vector<Value> mySlices;
+
+    /// The Z coordinate of the first buffered slice.
+    Integer myFirstSlice;
+
+    /// The Z coordinate of the next slice.
+    Integer myNextSlice;
+
+    /// 'true' when the file is closed.
+    bool myIsClosed;
+
+  }; // end of class ChunkedVolStreamWriter
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ChunkedVolWriter
+  /**
+   * Description of template struct 'ChunkedVolWriter' <p>
+   * \brief Aim: Export a 3D Image using the chunked volume format (see
+   * ChunkedVolFormat), each chunk being compressed independently.
+   *
+   * A functor can be specified to convert image values to the values
+   * stored in the file. Slices are streamed through a
+   * ChunkedVolStreamWriter, so that images computed on the fly (e.g.
+   * ConstImageAdapter) are never stored entirely.
+   *
+   * @tparam TImage the Image type.
+   * @tparam TFunctor the type of functor used in the export.
+   *
+   * @see testChunkedVol.cpp
+   */
+  template <typename TImage, typename TFunctor = functors::Identity>
+  struct ChunkedVolWriter
+  {
+    // ----------------------- Standard services ------------------------------
+    typedef TImage Image;
+    typedef typename TImage::Value Value;
+    typedef TFunctor Functor;
+    typedef ChunkedVolFormat Format;
+
+    BOOST_STATIC_ASSERT(TImage::Domain::dimension == 3);
+
+    /**
+     * Export an Image with the chunked volume format.
+     *
+     * @tparam Word the type of the values in the file (by default the
+     * type of the image values).
+     * @param filename name of the output file.
+     * @param aImage the image to export.
+     * @param chunkSize the size of the chunks along each axis.
+     * @param codec the compression of the chunks.
+     * @param aFunctor functor used to cast image values.
+     * @return true if no errors occur.
+     */
+    template <typename Word = Value>
+    static bool exportChunkedVol( const std::string & filename, const Image & aImage,
+                                  const Format::Point & chunkSize = Format::Point::diagonal( 64 ),
+                                  Format::Codec codec = Format::ZLIB,
+                                  const Functor & aFunctor = Functor() );
+  };
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ChunkedVolStreamWriter'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ChunkedVolStreamWriter' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TValue>
+  std::ostream&
+  operator<< ( std::ostream & out, const ChunkedVolStreamWriter<TValue> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/writers/ChunkedVolWriter.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ChunkedVolWriter_h
+
+#undef ChunkedVolWriter_RECURSES
+#endif // else defined(ChunkedVolWriter_RECURSES)
@@ -34,6 +34,7 @@
 /** Prevents repeated inclusion of headers. */
 #define LatticeSetByIntervals_h
 
+#include <map>
 #include <unordered_map>
 #include <boost/iterator/iterator_facade.hpp>
 #include <climits>
@@ -157,6 +158,9 @@ namespace DGtal
     /// @return a reference to the container
     Container& data() { return myData; }
 
+    /// @return a const reference to the container
+    const Container& data() const { return myData; }
+
     /// @}
 
     //------------------- conversion services -----------------------------
@@ -207,6 +211,19 @@ namespace DGtal
       return nb;
     }
       
+    /// @param p any point.
+    /// @return the number of times the point \a p is in the set (either 0 or 1).
+    ///
+    /// @note Logarithmic in the number of rows plus logarithmic in
+    /// the number of intervals of the row of \a p.
+    Size count( Point p ) const
+    {
+      const Integer x = p[ myAxis ];
+      p[ myAxis ]     = 0;
+      const auto   it = myData.find( p );
+      return it != myData.cend() ? it->second.count( x ) : 0;
+    }
+
     /// @return the the maximum number of elements the container is
     /// able to hold due to system or library implementation
     /// limitations.
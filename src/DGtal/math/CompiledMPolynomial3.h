@@ -0,0 +1,278 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file CompiledMPolynomial3.h
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module CompiledMPolynomial3.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(CompiledMPolynomial3_RECURSES)
+#error Recursive header files inclusion detected in CompiledMPolynomial3.h
+#else // defined(CompiledMPolynomial3_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define CompiledMPolynomial3_RECURSES
+
+#if !defined CompiledMPolynomial3_h
+/** Prevents repeated inclusion of headers. */
+#define CompiledMPolynomial3_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/math/MPolynomial.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  /////////////////////////////////////////////////////////////////////////////
+  // template class CompiledMPolynomial3
+  /**
+     Description of template class 'CompiledMPolynomial3' <p>
+     \brief Aim: A flat representation of a trivariate polynomial
+     MPolynomial<3,TRing>, that evaluates it at many points without
+     walking through the recursive MPolynomialEvaluator objects.
+
+     The coefficients \f$ c_{ijk} \f$ of \f$ \sum_i ( \sum_j ( \sum_k
+     c_{ijk} z^k ) y^j ) x^i \f$ are stored contiguously, together with
+     offset arrays describing the (dense) degrees in \a y and \a z of
+     each coefficient. Three kinds of evaluations are provided:
+
+     - at one point with operator();
+     - along a row of points with the same \a y and \a z coordinates,
+       with rowCoefficients and evaluateRow. The univariate
+       coefficients in \a x are computed once per row, then the row
+       is evaluated by simple loops over the points that compilers
+       vectorize;
+     - over a box with range, which returns an interval that contains
+       every value computed by the two previous methods within the
+       box (natural interval extension widened by a bound on the
+       rounding errors). It is used to cull boxes far from the zero
+       level set, see ImplicitPolynomial3Digitizer.
+
+     Evaluations follow exactly the sequence of floating-point
+     operations of MPolynomialEvaluator (sums of coefficients times
+     successive powers), so that values are bit-identical to the ones
+     of MPolynomial (as long as the compiler does not contract
+     operations into fused multiply-adds differently in both codes).
+
+     @code
+     MPolynomial<3, double> P = mmonomial<double>( 2, 0, 0 ) + mmonomial<double>( 0, 2, 0 )
+                              + mmonomial<double>( 0, 0, 2 ) - 1.0;
+     CompiledMPolynomial3<double> C( P );
+     double v = C( 0.5, 0.5, 0.5 ); // same as P( 0.5 )( 0.5 )( 0.5 )
+     @endcode
+
+     @tparam TRing the type of the coefficients and of the variables,
+     a floating-point number type.
+  */
+  template <typename TRing>
+  class CompiledMPolynomial3
+  {
+  public:
+    typedef CompiledMPolynomial3<TRing> Self;
+    typedef TRing Ring;
+    typedef std::size_t Size;
+
+    /// A closed interval [lo,hi] of values.
+    struct Interval
+    {
+      Ring lo; ///< the lower bound
+      Ring hi; ///< the upper bound
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+       Constructor. The zero polynomial.
+    */
+    CompiledMPolynomial3();
+
+    /**
+       Constructor from a polynomial.
+       @param poly any trivariate polynomial.
+    */
+    template <typename TAlloc>
+    CompiledMPolynomial3( const MPolynomial<3, Ring, TAlloc> & poly );
+
+    /**
+       Compiles the given polynomial.
+       @param poly any trivariate polynomial.
+    */
+    template <typename TAlloc>
+    void init( const MPolynomial<3, Ring, TAlloc> & poly );
+
+    // ----------------------- Evaluation services ----------------------------
+  public:
+
+    /**
+       @param k any variable index in 0..2.
+       @return the degree of the polynomial in the variable \a k (-1 for
+       the zero polynomial).
+    */
+    int degree( Dimension k ) const;
+
+    /**
+       @param x the first coordinate.
+       @param y the second coordinate.
+       @param z the third coordinate.
+       @return the value of the polynomial at (x,y,z).
+    */
+    Ring operator()( Ring x, Ring y, Ring z ) const;
+
+    /**
+       Computes the coefficients of the univariate polynomial in \a x
+       obtained by fixing the two last variables.
+
+       @param y the second coordinate.
+       @param z the third coordinate.
+       @param[out] coefficients an array of (at least) degree(0)+1
+       values, the coefficients of the polynomial in \a x.
+    */
+    void rowCoefficients( Ring y, Ring z, Ring* coefficients ) const;
+
+    /**
+       Evaluates a univariate polynomial in \a x at several abscissas.
+
+       @param coefficients the coefficients given by rowCoefficients.
+       @param x an array of \a n abscissas.
+       @param n the number of abscissas.
+       @param[out] values an array of \a n values.
+    */
+    void evaluateRow( const Ring* coefficients,
+                      const Ring* x, Size n, Ring* values ) const;
+
+    /**
+       Evaluates the polynomial at points (x[t],y,z), for t=0..n-1.
+
+       @param y the second coordinate.
+       @param z the third coordinate.
+       @param x an array of \a n abscissas.
+       @param n the number of abscissas.
+       @param[out] values an array of \a n values.
+    */
+    void evaluateRow( Ring y, Ring z, const Ring* x, Size n, Ring* values ) const;
+
+    /**
+       @param x any interval of abscissas.
+       @param y any interval of the second coordinate.
+       @param z any interval of the third coordinate.
+       @return an interval containing every value computed by
+       operator() or evaluateRow at points of the box \a x * \a y * \a z.
+    */
+    Interval range( const Interval & x, const Interval & y, const Interval & z ) const;
+
+    /**
+       @param coefficients the coefficients given by rowCoefficients.
+       @param x any interval of abscissas.
+       @return an interval containing every value computed by
+       evaluateRow with these coefficients at abscissas in \a x.
+    */
+    Interval rowRange( const Ring* coefficients, const Interval & x ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The coefficients c_ijk, ordered by i, then j, then k.
+    std::vector<Ring> myCoefficients;
+    /// For each pair (i,j), the first coefficient c_ij0 (plus one last offset).
+    std::vector<Size> myZOffsets;
+    /// For each i, the first pair (i,0) in myZOffsets (plus one last offset).
+    std::vector<Size> myYOffsets;
+    /// The degree in each variable.
+    int myDegrees[ 3 ];
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+       @param x any interval.
+       @param d any non-negative integer.
+       @param[out] powers the intervals containing x^0, ..., x^d.
+    */
+    static void powers( const Interval & x, int d, Interval* powers );
+
+    /**
+       @param a any interval.
+       @param b any interval.
+       @return an interval containing the products of a and b.
+    */
+    static Interval product( const Interval & a, const Interval & b );
+
+    /**
+       @param x any interval.
+       @return the maximal absolute value in \a x.
+    */
+    static Ring magnitude( const Interval & x );
+
+    /**
+       @param n the length of a sequence of floating-point operations.
+       @param m a bound on the sum of the absolute values of its terms.
+       @return a bound on the rounding error of the sequence.
+    */
+    static Ring roundingError( int n, Ring m );
+
+  }; // end of class CompiledMPolynomial3
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'CompiledMPolynomial3'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'CompiledMPolynomial3' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TRing>
+  std::ostream&
+  operator<< ( std::ostream & out, const CompiledMPolynomial3<TRing> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/math/CompiledMPolynomial3.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined CompiledMPolynomial3_h
+
+#undef CompiledMPolynomial3_RECURSES
+#endif // else defined(CompiledMPolynomial3_RECURSES)
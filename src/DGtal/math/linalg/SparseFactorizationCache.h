@@ -0,0 +1,352 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SparseFactorizationCache.h
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module SparseFactorizationCache.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SparseFactorizationCache_RECURSES)
+#error Recursive header files inclusion detected in SparseFactorizationCache.h
+#else // defined(SparseFactorizationCache_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SparseFactorizationCache_RECURSES
+
+#if !defined SparseFactorizationCache_h
+/** Prevents repeated inclusion of headers. */
+#define SparseFactorizationCache_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include <DGtal/math/linalg/CDynamicMatrix.h>
+#include <DGtal/math/linalg/CDynamicVector.h>
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  namespace detail
+  {
+    /// True when a solver offers separate symbolic (analyzePattern)
+    /// and numeric (factorize) factorizations of a matrix, like
+    /// Eigen's Simplicial solvers or SparseLU.
+    template < typename TSolver, typename TMatrix, typename = void >
+    struct HasSymbolicFactorization : std::false_type {};
+
+    template < typename TSolver, typename TMatrix >
+    struct HasSymbolicFactorization
+    < TSolver, TMatrix,
+      std::void_t< decltype( std::declval<TSolver&>().analyzePattern( std::declval<const TMatrix&>() ) ),
+                   decltype( std::declval<TSolver&>().factorize( std::declval<const TMatrix&>() ) ) > >
+      : std::true_type {};
+
+    /// True for iterative solvers (e.g. Eigen's ConjugateGradient),
+    /// which refer to the matrix given to compute instead of
+    /// factorizing it.
+    template < typename TSolver, typename = void >
+    struct IsIterativeSolver : std::false_type {};
+
+    template < typename TSolver >
+    struct IsIterativeSolver
+    < TSolver, std::void_t< decltype( std::declval<TSolver&>().setTolerance( 1.0 ) ) > >
+      : std::true_type {};
+  } // namespace detail
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SparseFactorizationCache
+  /**
+     Description of template class 'SparseFactorizationCache' <p>
+     \brief Aim: Keeps a few factorizations of sparse matrices that
+     share the same sparsity pattern, keyed by a parameter (e.g. a
+     time step), so that solving again for an already seen parameter
+     costs no factorization, and factorizing for a new one only
+     costs a numeric factorization.
+
+     The cache has a fixed number of slots, each holding a solver. A
+     key that is not in the cache takes the least recently used slot,
+     whose solver is refactorized with `factorize` only when its
+     sparsity pattern is the one of the new matrix (the symbolic
+     analysis, i.e. the fill-reducing ordering and the elimination
+     tree, is kept); otherwise, or when the solver has no separate
+     symbolic step, `compute` is called. Iterative solvers, which
+     refer to their matrix, are given a copy kept in the cache.
+
+     \code
+     typedef SparseFactorizationCache< EigenLinearAlgebraBackend,
+                                       EigenLinearAlgebraBackend::SolverSimplicialLDLT > Cache;
+     Cache cache( 3 );
+     for ( double dt : { 0.1, 0.01, 0.1 } ) // the last one is not factorized
+       x = cache.get( dt, [&] { return mass - dt * laplacian; } ).solve( b );
+     \endcode
+
+     Besides, once a matrix \f$ A \f$ is factorized, the static
+     methods dirichletUpdate() and solveDirichlet() solve \f$ A x = b
+     \f$ with Dirichlet conditions \f$ x_i = u_i \f$ on a few nodes
+     \f$ i \f$ as a low-rank correction of \f$ A^{-1} \f$ (the inverse
+     of the small capacitance matrix \f$ (A^{-1})_{BB} \f$ on the set
+     \f$ B \f$ of constrained nodes), without factorizing the reduced
+     system \f$ A_d \f$ of DirichletConditions. The result is the one
+     of DirichletConditions for an invertible \f$ A \f$. Changing the
+     set of constrained nodes only costs \f$ |B| \f$ solves.
+
+     @tparam TLinearAlgebraBackend linear algebra backend used (i.e. EigenLinearAlgebraBackend).
+     @tparam TSolver the solver type, a model of CLinearAlgebraSolver (e.g. EigenLinearAlgebraBackend::SolverSimplicialLDLT).
+     @tparam TKey the type of the parameter indexing the factorizations, which must be equality comparable.
+
+     @see testSparseFactorizationCache.cpp
+  */
+  template < typename TLinearAlgebraBackend, typename TSolver, typename TKey = double >
+  class SparseFactorizationCache
+  {
+  public:
+    typedef TLinearAlgebraBackend LinearAlgebraBackend;
+    typedef TSolver Solver;
+    typedef TKey Key;
+    typedef SparseFactorizationCache< TLinearAlgebraBackend, TSolver, TKey > Self;
+
+    typedef typename LinearAlgebraBackend::DenseVector::Index  Index;
+    typedef typename LinearAlgebraBackend::DenseVector::Scalar Scalar;
+    typedef typename LinearAlgebraBackend::DenseVector         DenseVector;
+    typedef typename LinearAlgebraBackend::IntegerVector       IntegerVector;
+    typedef typename LinearAlgebraBackend::DenseMatrix         DenseMatrix;
+    typedef typename LinearAlgebraBackend::SparseMatrix        SparseMatrix;
+    typedef typename SparseMatrix::StorageIndex                StorageIndex;
+    typedef std::size_t                                        Size;
+
+    BOOST_CONCEPT_ASSERT(( concepts::CDynamicVector<DenseVector> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CDynamicMatrix<DenseMatrix> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CDynamicMatrix<SparseMatrix> ));
+
+    /// The sparsity pattern of a compressed sparse matrix.
+    struct SparsityPattern
+    {
+      Index rows = 0;
+      Index cols = 0;
+      std::vector< StorageIndex > outer;
+      std::vector< StorageIndex > inner;
+
+      /// @param A any sparse matrix.
+      /// @return 'true' if this is the pattern of A.
+      bool matches( const SparseMatrix & A ) const;
+      /// Sets this pattern to the one of A.
+      /// @param A any sparse matrix.
+      void assign( const SparseMatrix & A );
+    };
+
+    /// The low-rank correction that imposes Dirichlet conditions on a
+    /// set of nodes to a factorized system.
+    struct DirichletUpdate
+    {
+      /// The constrained nodes.
+      std::vector< Index > nodes;
+      /// The inverse of the capacitance matrix \f$ (A^{-1})_{BB} \f$.
+      DenseMatrix inverseCapacitance;
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param capacity the maximal number of kept factorizations (at least 1).
+     */
+    SparseFactorizationCache( Size capacity = 4 );
+
+    /// Copy constructor (solvers are not copyable).
+    SparseFactorizationCache( const Self & other ) = delete;
+    /// Assignment (solvers are not copyable).
+    Self & operator=( const Self & other ) = delete;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /// @return the maximal number of kept factorizations.
+    Size capacity() const;
+
+    /// @return the number of kept factorizations.
+    Size size() const;
+
+    /// @param aKey any key.
+    /// @return 'true' if a factorization is kept for this key.
+    bool contains( const Key & aKey ) const;
+
+    /// Forgets all factorizations and symbolic analyses.
+    void clear();
+
+    /**
+     * Factorizes a matrix and keeps its factorization for the given
+     * key, replacing the one of the key or the least recently used
+     * one.
+     *
+     * @param aKey the parameter of the matrix.
+     * @param A the matrix to factorize.
+     * @return the solver holding the factorization of A (valid until
+     * the next call to compute, get or clear).
+     */
+    const Solver & compute( const Key & aKey, const SparseMatrix & A );
+
+    /**
+     * Returns the factorization kept for the given key, or builds
+     * and factorizes its matrix.
+     *
+     * @tparam TMatrixBuilder the type of a function returning a SparseMatrix.
+     * @param aKey the parameter of the matrix.
+     * @param aBuilder called to build the matrix only when aKey is
+     * not in the cache.
+     * @return the solver holding the factorization (valid until the
+     * next call to compute, get or clear).
+     */
+    template < typename TMatrixBuilder >
+    const Solver & get( const Key & aKey, const TMatrixBuilder & aBuilder );
+
+    /// @return the number of calls to get answered from the cache.
+    Size nbHits() const;
+
+    /// @return the number of numeric factorizations done so far.
+    Size nbFactorizations() const;
+
+    /// @return the number of symbolic analyses done so far (they are
+    /// counted as part of the factorizations when the solver has no
+    /// separate symbolic step).
+    Size nbSymbolicAnalyses() const;
+
+    /**
+     * Factorizes A in a solver, redoing the symbolic analysis only if
+     * the pattern of A differs from the pattern of the previous
+     * factorization of this solver.
+     *
+     * @param[in,out] aSolver any solver.
+     * @param[in,out] aPattern the pattern of the last matrix factorized by aSolver.
+     * @param A the matrix to factorize.
+     * @return 'true' if the symbolic analysis was reused.
+     */
+    static bool refactorize( Solver & aSolver, SparsityPattern & aPattern,
+                             const SparseMatrix & A );
+
+    /**
+     * Prepares the resolution of a factorized system \f$ A x = b \f$
+     * with Dirichlet conditions on the nodes \f$ i \f$ such that
+     * `p[i]=1`.
+     *
+     * @param aSolver a solver holding the factorization of an invertible matrix A.
+     * @param p the vector such that `p[i]=1` whenever the i-th node
+     * is a boundary node, `p[i]=0` otherwise.
+     * @return the low-rank correction to give to solveDirichlet.
+     */
+    static DirichletUpdate dirichletUpdate( const Solver & aSolver, const IntegerVector & p );
+
+    /**
+     * Solves \f$ A x = b \f$ with Dirichlet conditions, i.e. returns
+     * the same solution as DirichletConditions::dirichletSolution of
+     * the reduced system.
+     *
+     * @param aSolver the solver given to dirichletUpdate.
+     * @param anUpdate the result of dirichletUpdate.
+     * @param b the right-hand side.
+     * @param u the vector giving the constrained Dirichlet values on
+     * the boundary nodes.
+     * @return the solution \f$ x \f$, such that \f$ x_i = u_i \f$ on
+     * the boundary nodes.
+     */
+    static DenseVector solveDirichlet( const Solver & aSolver, const DirichletUpdate & anUpdate,
+                                       const DenseVector & b, const DenseVector & u );
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// A kept factorization.
+    struct Slot
+    {
+      Key key;
+      bool used = false;
+      Size lastUse = 0;
+      std::unique_ptr< Solver > solver;
+      SparsityPattern pattern;
+      /// Copy of the matrix, for iterative solvers only.
+      SparseMatrix matrix;
+    };
+
+    /// The slots of the cache.
+    std::vector< Slot > mySlots;
+    /// Incremented at each access, to find the least recently used slot.
+    Size myClock;
+    /// Number of cache hits.
+    Size myNbHits;
+    /// Number of numeric factorizations.
+    Size myNbFactorizations;
+    /// Number of symbolic analyses.
+    Size myNbSymbolicAnalyses;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// @param aKey any key.
+    /// @return the slot of this key, or mySlots.size().
+    Size find( const Key & aKey ) const;
+
+  }; // end of class SparseFactorizationCache
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'SparseFactorizationCache'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'SparseFactorizationCache' to write.
+   * @return the output stream after the writing.
+   */
+  template < typename TLinearAlgebraBackend, typename TSolver, typename TKey >
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const SparseFactorizationCache< TLinearAlgebraBackend, TSolver, TKey > & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/math/linalg/SparseFactorizationCache.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SparseFactorizationCache_h
+
+#undef SparseFactorizationCache_RECURSES
+#endif // else defined(SparseFactorizationCache_RECURSES)
@@ -0,0 +1,378 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file AdaptiveGaussDigitizer.h
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module AdaptiveGaussDigitizer.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(AdaptiveGaussDigitizer_RECURSES)
+#error Recursive header files inclusion detected in AdaptiveGaussDigitizer.h
+#else // defined(AdaptiveGaussDigitizer_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define AdaptiveGaussDigitizer_RECURSES
+
+#if !defined AdaptiveGaussDigitizer_h
+/** Prevents repeated inclusion of headers. */
+#define AdaptiveGaussDigitizer_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/CountedConstPtrOrConstPtr.h"
+#include "DGtal/base/ThreadPool.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerByIntervals.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  namespace functors
+  {
+    /////////////////////////////////////////////////////////////////////////////
+    // Block classifiers
+    //
+    // A block classifier is a functor that takes the lowest and
+    // uppest points of an Euclidean box and returns:
+    // - INSIDE if every point of the box is inside the shape or on its boundary,
+    // - OUTSIDE if every point of the box is strictly outside the shape,
+    // - ON if it cannot tell.
+
+    /**
+       Description of template class 'BoundingBoxBlockClassifier' <p>
+       \brief Aim: A block classifier for AdaptiveGaussDigitizer that
+       only knows that the shape lies in its bounding box.
+
+       @tparam TEuclideanShape a model of CEuclideanBoundedShape.
+    */
+    template <typename TEuclideanShape>
+    struct BoundingBoxBlockClassifier
+    {
+      typedef TEuclideanShape EuclideanShape;
+      typedef typename EuclideanShape::RealPoint RealPoint;
+
+      /**
+         Constructor.
+         @param aShape any bounded shape.
+      */
+      BoundingBoxBlockClassifier( const EuclideanShape & aShape );
+
+      /**
+         @param lo the lowest point of a box.
+         @param up the uppest point of a box.
+         @return OUTSIDE if the box does not meet the bounding box, ON otherwise.
+      */
+      Orientation operator()( const RealPoint & lo, const RealPoint & up ) const;
+
+      /// The lowest point of the bounding box.
+      RealPoint myLowerBound;
+      /// The uppest point of the bounding box.
+      RealPoint myUpperBound;
+      /// A tolerance on the bounding box.
+      double myMargin;
+    };
+
+    /**
+       Description of template class 'BallBlockClassifier' <p>
+       \brief Aim: A block classifier for AdaptiveGaussDigitizer for
+       shapes that contain a ball and are contained in a concentric
+       ball, e.g. balls or star-shaped objects whose radius is
+       bounded.
+
+       @tparam TSpace any space.
+    */
+    template <typename TSpace>
+    struct BallBlockClassifier
+    {
+      typedef TSpace Space;
+      typedef typename Space::RealPoint RealPoint;
+
+      /**
+         Constructor.
+         @param aCenter the center of both balls.
+         @param anInnerRadius the radius of a ball included in the shape.
+         @param anOuterRadius the radius of a ball containing the shape.
+      */
+      BallBlockClassifier( const RealPoint & aCenter,
+                           double anInnerRadius, double anOuterRadius );
+
+      /**
+         @param lo the lowest point of a box.
+         @param up the uppest point of a box.
+         @return INSIDE if the box is in the inner ball, OUTSIDE if it
+         does not meet the outer ball, ON otherwise.
+      */
+      Orientation operator()( const RealPoint & lo, const RealPoint & up ) const;
+
+      /// The center of the balls.
+      RealPoint myCenter;
+      /// The inner radius.
+      double myInnerRadius;
+      /// The outer radius.
+      double myOuterRadius;
+      /// A tolerance on the radii.
+      double myMargin;
+    };
+
+    /**
+       Description of template class 'LipschitzBlockClassifier' <p>
+       \brief Aim: A block classifier for AdaptiveGaussDigitizer for
+       implicit shapes whose function \a f is Lipschitz: if \f$ |f(c)|
+       > L r \f$, where \a c is the center of the box and \a r its
+       half diagonal, \a f has the same sign in the whole box, hence
+       the box has the orientation of its center.
+
+       The rounding errors of the evaluation of \a f are assumed to be
+       relatively smaller than 1e-9.
+
+       @tparam TImplicitShape a model of CImplicitFunction and
+       CEuclideanOrientedShape, whose orientation is given by the sign
+       of the function (e.g. ImplicitBall).
+    */
+    template <typename TImplicitShape>
+    struct LipschitzBlockClassifier
+    {
+      typedef TImplicitShape ImplicitShape;
+      typedef typename ImplicitShape::RealPoint RealPoint;
+
+      /**
+         Constructor.
+         @param aShape any implicit shape, which is referenced.
+         @param aLipschitzConstant a Lipschitz constant of its function.
+      */
+      LipschitzBlockClassifier( ConstAlias<ImplicitShape> aShape,
+                                double aLipschitzConstant );
+
+      /**
+         @param lo the lowest point of a box.
+         @param up the uppest point of a box.
+         @return the orientation of the box, or ON.
+      */
+      Orientation operator()( const RealPoint & lo, const RealPoint & up ) const;
+
+      /// The implicit shape.
+      const ImplicitShape* myShape;
+      /// The Lipschitz constant.
+      double myLipschitzConstant;
+    };
+
+  } // namespace functors
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class AdaptiveGaussDigitizer
+  /**
+     Description of template class 'AdaptiveGaussDigitizer' <p>
+     \brief Aim: Computes the whole Gauss digitization of a shape
+     given by a GaussDigitizer, without evaluating the shape
+     orientation at every point of the domain.
+
+     The domain is cut into blocks of 32^n points, which are processed
+     recursively as in an octree (quadtree in 2D): a block classifier
+     (see functors::BoundingBoxBlockClassifier,
+     functors::BallBlockClassifier and
+     functors::LipschitzBlockClassifier) tells if the Euclidean box
+     of a block is inside, outside or undecided. Only undecided
+     blocks are split, down to blocks of 4^n points, whose points are
+     then classified by GaussDigitizer::orientation. Slabs of blocks
+     along the last axis are processed in parallel with the default
+     ThreadPool. Implicit polynomial shapes are better digitized by
+     ImplicitPolynomial3Digitizer.
+
+     The result is exactly the one of GaussDigitizer, provided the
+     classifier is correct. It is written either in a dense image
+     (e.g. bit-packed with bool values) or in an
+     ImageContainerByIntervals, in which case the dense image is never
+     built.
+
+     @code
+     typedef ImplicitBall<Z3i::Space> Ball;
+     typedef GaussDigitizer<Z3i::Space, Ball> Digitizer;
+     typedef functors::LipschitzBlockClassifier<Ball> Classifier;
+     Ball ball( Z3i::RealPoint( 0, 0, 0 ), 10.0 );
+     Digitizer digitizer;
+     digitizer.attach( ball );
+     digitizer.init( ball.getLowerBound(), ball.getUpperBound(), 0.01 );
+     AdaptiveGaussDigitizer<Z3i::Space, Ball, Classifier>
+       adaptive( digitizer, Classifier( ball, 1.0 ) );
+     ImageContainerByIntervals<Z3i::Domain> image( digitizer.getDomain() );
+     adaptive.digitize( image );
+     @endcode
+
+     @tparam TSpace the type of digital Space.
+     @tparam TEuclideanShape a model of CEuclideanOrientedShape.
+     @tparam TBlockClassifier the type of block classifier.
+  */
+  template <typename TSpace, typename TEuclideanShape, typename TBlockClassifier>
+  class AdaptiveGaussDigitizer
+  {
+  public:
+    typedef AdaptiveGaussDigitizer<TSpace, TEuclideanShape, TBlockClassifier> Self;
+    typedef TSpace Space;
+    typedef TEuclideanShape EuclideanShape;
+    typedef TBlockClassifier BlockClassifier;
+    typedef GaussDigitizer<Space, EuclideanShape> Digitizer;
+    typedef typename Space::Integer Integer;
+    typedef typename Space::Point Point;
+    typedef typename Space::RealPoint RealPoint;
+    typedef HyperRectDomain<Space> Domain;
+    typedef typename Domain::Size Size;
+    static const Dimension dimension = Space::dimension;
+
+    /// The size of the blocks processed by a task.
+    static constexpr Integer BLOCK_SIZE = 32;
+    /// The size of the blocks whose points are evaluated.
+    static constexpr Integer LEAF_SIZE  = 4;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+       Constructor.
+       @param aDigitizer an initialized Gauss digitizer, which is referenced.
+       @param aClassifier the block classifier of its shape.
+    */
+    AdaptiveGaussDigitizer( ConstAlias<Digitizer> aDigitizer,
+                            const BlockClassifier & aClassifier );
+
+    // ----------------------- Digitization services --------------------------
+  public:
+
+    /**
+       Digitizes the shape in the domain of the given image: each
+       point is set to the value 'true' (converted to TValue) if it
+       is inside the shape, 'false' otherwise.
+
+       @tparam TValue the type of the image values (e.g. bool).
+       @param[in,out] anImage any image, whose values are all set.
+       @return the number of points whose orientation was evaluated.
+    */
+    template <typename TValue>
+    Size digitize( ImageContainerBySTLVector<Domain, TValue> & anImage ) const;
+
+    /**
+       Digitizes the shape in the domain of the given image.
+
+       @param[in,out] anImage any image stored by intervals, whose
+       values are all set.
+       @return the number of points whose orientation was evaluated.
+    */
+    Size digitize( ImageContainerByIntervals<Domain> & anImage ) const;
+
+    /// @return the Gauss digitizer.
+    const Digitizer & digitizer() const;
+
+    /// @return the block classifier.
+    const BlockClassifier & classifier() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The Gauss digitizer.
+    CountedConstPtrOrConstPtr<Digitizer> myDigitizer;
+    /// The block classifier.
+    BlockClassifier myClassifier;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+       Digitizes a slab of blocks.
+
+       @param aSlabDomain the domain of the slab (see slabDomain).
+       @param aWriter the functor setting the value of a box [lo,up].
+       @return the number of points whose orientation was evaluated.
+    */
+    template <typename TWriter>
+    Size digitizeSlab( const Domain & aSlabDomain, TWriter & aWriter ) const;
+
+    /**
+       Digitizes the block [lo,up] recursively.
+
+       @param lo the lowest point of the block.
+       @param up the uppest point of the block.
+       @param aWriter the functor setting the value of a box [lo,up].
+       @return the number of points whose orientation was evaluated.
+    */
+    template <typename TWriter>
+    Size digitizeBlock( const Point & lo, const Point & up, TWriter & aWriter ) const;
+
+    /**
+       @param aDomain any domain.
+       @param aSlab the index of a slab along the last axis.
+       @return the domain of this slab.
+    */
+    static Domain slabDomain( const Domain & aDomain, Size aSlab );
+
+    /**
+       @param aDomain any domain.
+       @return the number of slabs of blocks along the last axis.
+    */
+    static Size nbSlabs( const Domain & aDomain );
+
+  }; // end of class AdaptiveGaussDigitizer
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'AdaptiveGaussDigitizer'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'AdaptiveGaussDigitizer' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSpace, typename TEuclideanShape, typename TBlockClassifier>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const AdaptiveGaussDigitizer<TSpace, TEuclideanShape, TBlockClassifier> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/shapes/AdaptiveGaussDigitizer.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined AdaptiveGaussDigitizer_h
+
+#undef AdaptiveGaussDigitizer_RECURSES
+#endif // else defined(AdaptiveGaussDigitizer_RECURSES)
@@ -114,6 +114,12 @@ namespace DGtal
     */
     void attach( ConstAlias<EuclideanShape> shape );
 
+    /**
+       @pre a shape has been attached.
+       @return the attached Euclidean shape.
+    */
+    const EuclideanShape & shape() const;
+
     /**
        Initializes the digital bounds of the digitizer so as to cover
        at least the space specified by [xLow] and [xUp]. The real
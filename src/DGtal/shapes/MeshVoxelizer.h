@@ -32,7 +32,10 @@
 
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
+#include <vector>
 #include "DGtal/helpers/StdDefs.h"
+#include "DGtal/base/Bits.h"
+#include "DGtal/base/ThreadPool.h"
 #include "DGtal/base/ConstAlias.h"
 #include "DGtal/shapes/Mesh.h"
 #include "DGtal/shapes/IntersectionTarget.h"
@@ -66,6 +69,16 @@ namespace DGtal
    This approach is a CPU straightforward implementation of
    @cite Laine13.
 
+   When voxelizing a whole mesh, triangles are first binned into
+   tiles of the domain. Each tile is digitized by a single task of
+   the default ThreadPool into a bit-packed occupancy volume whose
+   words are owned by exactly one tile, so that no synchronization is
+   needed before the final insertion into the output set.
+
+   The voxels lying inside a closed mesh are given by
+   voxelizeInterior, which fills each row of the domain by a scanline
+   along the x-axis (even-odd or non-zero winding rule).
+
    6 and 26 templates are the following ones:
 
    @image html 6-sep.png "Template for 6-separating digitization"
@@ -150,6 +163,37 @@ namespace DGtal
                   const MeshPoint &a, const MeshPoint &b, const MeshPoint &c,
                   const double scaleFactor = 1.0);
 
+    /// Rule deciding whether a point is inside a mesh from the
+    /// crossings of a ray with its triangles.
+    enum FillRule { FILL_EVEN_ODD, FILL_NON_ZERO };
+
+    /**
+     * Inserts into the digital set the voxels of its domain whose
+     * center lies inside the (closed) mesh. Rows of voxels along the
+     * x-axis are filled from the sorted crossings of the row with the
+     * triangles. A voxel whose center lies on the mesh is inside if
+     * the mesh is entered there, hence the voxelization of a box with
+     * integer corners @a l and @a u is the half-open box [l,u).
+     *
+     * Use voxelize on the same set to also get the separating surface.
+     *
+     * @param [out] outputSet the set that collects the voxels.
+     * @param [in] aMesh the mesh to fill (vertex coordinates will
+     * be casted to @e PointR3 points).
+     * @param [in] scaleFactor the scale factor to apply to the mesh
+     * (default=1.0)
+     * @param [in] aRule either FILL_EVEN_ODD (a point is inside if
+     * a ray from it crosses the mesh an odd number of times, default)
+     * or FILL_NON_ZERO (a point is inside if its winding number is not
+     * null, which requires consistently oriented faces).
+     * @tparam MeshPoint the type of point of the mesh.
+     */
+    template<typename MeshPoint>
+    void voxelizeInterior(DigitalSet &outputSet,
+                          const Mesh<MeshPoint> &aMesh,
+                          const double scaleFactor = 1.0,
+                          const FillRule aRule = FILL_EVEN_ODD);
+
 
 
     // ----------------------- Internal services ------------------------------
@@ -209,10 +253,74 @@ namespace DGtal
                           const VectorR3& n,
                           const std::pair<PointZ3, PointZ3>& bbox);
 
-    // ----------------------- Members ------------------------------
+    // ----------------------- Internals ------------------------------
 
   private:
 
+    /// A (scaled) triangle of a mesh with its normal and integer
+    /// bounding box.
+    struct Triangle
+    {
+      PointR3 A, B, C;
+      VectorR3 n;
+      std::pair<PointZ3, PointZ3> bbox;
+    };
+
+    /**
+     * Bit-packed occupancy of the voxels of a domain. Each row along
+     * the x-axis starts on a new 64-bit word, so that distinct rows or
+     * distinct 64-voxel chunks of a row never share a word.
+     */
+    struct OccupancyVolume
+    {
+      /// Builds an empty volume over the domain.
+      OccupancyVolume( const Domain & aDomain );
+      /// @return the index of the first word of the row (y,z).
+      std::size_t row( typename PointZ3::Coordinate y, typename PointZ3::Coordinate z ) const;
+      /// Marks voxel @a v (in the domain) as occupied.
+      void set( const PointZ3 & v );
+      /// Marks the voxels [x0,x1) of the row starting at word @a r.
+      void setRange( std::size_t r, typename PointZ3::Coordinate x0, typename PointZ3::Coordinate x1 );
+      /// Inserts the occupied voxels into the set, in domain order.
+      void insertInto( DigitalSet & outputSet ) const;
+
+      PointZ3 lower, upper;
+      std::size_t nbRowWords;
+      std::vector<DGtal::uint64_t> words;
+    };
+
+    /// @return the triangle (a,b,c) scaled by @a scaleFactor.
+    template<typename MeshPoint>
+    static
+    Triangle makeTriangle(const MeshPoint &a, const MeshPoint &b, const MeshPoint &c,
+                          const double scaleFactor);
+
+    /// @return the triangles of the (fan triangulated) faces of the mesh.
+    template<typename MeshPoint>
+    static
+    std::vector<Triangle> meshTriangles(const Mesh<MeshPoint> &aMesh,
+                                        const double scaleFactor);
+
+    /**
+     * Voxelize ABC, calling @a insert on each voxel of the digitization
+     * lying in @a bbox.
+     * @param A Point A
+     * @param B Point B
+     * @param C Point C
+     * @param n normal of ABC
+     * @param bbox box of the voxels to consider
+     * @param insert a functor taking a PointZ3
+     */
+    template<typename Insert>
+    void voxelizeTriangle(const PointR3& A,
+                          const PointR3& B,
+                          const PointR3& C,
+                          const VectorR3& n,
+                          const std::pair<PointZ3, PointZ3>& bbox,
+                          const Insert& insert);
+
+    // ----------------------- Members ------------------------------
+
     ///Intersection target
     IntersectionTarget myIntersectionTarget;
   };
@@ -45,6 +45,7 @@
 #include <string>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/IntegerSequenceIterator.h"
+#include "DGtal/base/CompressedRows.h"
 #include "DGtal/helpers/StdDefs.h"
 
 namespace DGtal
@@ -84,6 +85,13 @@ namespace DGtal
      See also SurfaceMeshReader and SurfaceMeshWriter for input/output
      operations for SurfaceMesh.
 
+     All incidence tables (incident vertices and faces, neighbor
+     vertices and faces, faces around edges) are stored as compressed
+     rows (see CompressedRows), i.e. one array of indices per table
+     instead of one vector per element. Accessors thus return
+     light ranges (IndexRange) on these arrays, which are converted
+     to vectors when needed.
+
      @tparam TRealPoint an arbitrary model of 3D RealPoint.
      @tparam TRealVector an arbitrary model of 3D RealVector.
   */
@@ -116,6 +124,12 @@ namespace DGtal
     typedef std::vector< Face >                     Faces;
     typedef std::vector< WeightedFace >             WeightedFaces;
     typedef std::pair< Vertex, Vertex >             VertexPair;
+    /// The type for storing one range of indices per element (faces,
+    /// vertices or edges).
+    typedef CompressedRows< Index >                 IndexRanges;
+    /// The type of a constant range of indices (e.g. the vertices of
+    /// a face), convertible to Vertices or Faces.
+    typedef typename IndexRanges::ConstRow          IndexRange;
 
     // Required by CUndirectedSimpleLocalGraph
     typedef std::set<Vertex>                   VertexSet;
@@ -306,29 +320,29 @@ namespace DGtal
     /// @param j any vertex of the mesh
     /// @return the edge index of edge (i,j) or `nbEdges()` if this
     /// edge does not exist.
-    /// @note O(log E) time complexity.
+    /// @note O(d) time complexity, where d is the number of neighbors of \a i.
     Edge makeEdge( Vertex i, Vertex j ) const;
 
     /// @param f any face
-    /// @return a const reference to the range giving for face \a f 
+    /// @return the range giving for face \a f 
     /// its incident vertices.
-    const Vertices&  incidentVertices( Face f ) const
+    IndexRange incidentVertices( Face f ) const
     { return myIncidentVertices[ f ]; }
 
     /// @param v any vertex
-    /// @return a const reference to the range giving for vertex \a v
+    /// @return the range giving for vertex \a v
     /// its incident faces.
-    const Faces& incidentFaces( Vertex v ) const
+    IndexRange incidentFaces( Vertex v ) const
     { return myIncidentFaces[ v ]; }
     
     /// @param f any face
-    /// @return a const reference to the range of neighbor faces for face \a f.
-    const Faces& neighborFaces( Face f ) const
+    /// @return the range of neighbor faces for face \a f.
+    IndexRange neighborFaces( Face f ) const
     { return myNeighborFaces[ f ]; }
 
     /// @param v any vertex
-    /// @return a const reference to the range of neighbor vertices for vertex \a v.
-    const Vertices& neighborVertices( Vertex v ) const
+    /// @return the range of neighbor vertices for vertex \a v.
+    IndexRange neighborVertices( Vertex v ) const
     { return myNeighborVertices[ v ]; }
 
     /// @param e any edge
@@ -339,49 +353,49 @@ namespace DGtal
     { return myEdgeVertices[ e ]; }
     
     /// @param e any edge
-    /// @return a const reference to the range giving for edge \a e
+    /// @return the range giving for edge \a e
     /// its incident faces (one, two, or more if non manifold)
-    const Faces& edgeFaces( Edge e ) const
+    IndexRange edgeFaces( Edge e ) const
     { return myEdgeFaces[ e ]; }
 
     /// @param e any edge
-    /// @return a const reference to the range giving for edge \a e
+    /// @return the range giving for edge \a e
     /// its incident faces to its right (zero if open, one, or more if
     /// non manifold).
     ///
     /// @note an edge is stored as a vertex pair (i,j), i < j. So a
     /// face to its right, being defined ccw, means that the face is
     /// some `(..., j, i, ... )`.
-    const Faces& edgeRightFaces( Edge e ) const 
+    IndexRange edgeRightFaces( Edge e ) const 
     { return myEdgeRightFaces[ e ]; }
 
     /// @param e any edge
-    /// @return a const reference to the range giving for edge \a e
+    /// @return the range giving for edge \a e
     /// its incident faces to its left (zero if open, one, or more if
     /// non manifold).
     ///
     /// @note an edge is stored as a vertex pair (i,j), i < j. So a
     /// face to its left, being defined ccw, means that the face is
     /// some `(..., i, j, ... )`.
-    const Faces& edgeLeftFaces( Edge e ) const 
+    IndexRange edgeLeftFaces( Edge e ) const 
     { return myEdgeLeftFaces[ e ]; }
 
-    /// @return a const reference to the vector giving for each face
+    /// @return a const reference to the table giving for each face
     /// its incident vertices.
-    const std::vector< Vertices >& allIncidentVertices() const
+    const IndexRanges& allIncidentVertices() const
     { return myIncidentVertices; }
 
-    /// @return a const reference to the vector giving for each vertex
+    /// @return a const reference to the table giving for each vertex
     /// its incident faces.
-    const std::vector< Faces >& allIncidentFaces() const
+    const IndexRanges& allIncidentFaces() const
     { return myIncidentFaces; }
     
-    /// @return a const reference to the vector of neighbor faces for each face.
-    const std::vector< Faces >& allNeighborFaces() const
+    /// @return a const reference to the table of neighbor faces for each face.
+    const IndexRanges& allNeighborFaces() const
     { return myNeighborFaces; }
 
-    /// @return a const reference to the vector of neighbor vertices for each vertex.
-    const std::vector< Vertices >& allNeighborVertices() const
+    /// @return a const reference to the table of neighbor vertices for each vertex.
+    const IndexRanges& allNeighborVertices() const
     { return myNeighborVertices; }
 
     /// @return a vector giving for each edge its two vertices (as a
@@ -391,29 +405,29 @@ namespace DGtal
     const std::vector< VertexPair >& allEdgeVertices() const
     { return myEdgeVertices; }
     
-    /// @return a const reference to the vector giving for each edge
+    /// @return a const reference to the table giving for each edge
     /// its incident faces (one, two, or more if non manifold)
-    const std::vector< Faces >& allEdgeFaces() const
+    const IndexRanges& allEdgeFaces() const
     { return myEdgeFaces; }
 
-    /// @return a const reference to the vector giving for each edge
+    /// @return a const reference to the table giving for each edge
     /// its incident faces to its right (zero if open, one, or more if
     /// non manifold).
     ///
     /// @note an edge is stored as a vertex pair (i,j), i < j. So a
     /// face to its right, being defined ccw, means that the face is
     /// some `(..., j, i, ... )`.
-    const std::vector< Faces >& allEdgeRightFaces() const 
+    const IndexRanges& allEdgeRightFaces() const 
     { return myEdgeRightFaces; }
 
-    /// @return a const reference to the vector giving for each edge
+    /// @return a const reference to the table giving for each edge
     /// its incident faces to its left (zero if open, one, or more if
     /// non manifold).
     ///
     /// @note an edge is stored as a vertex pair (i,j), i < j. So a
     /// face to its left, being defined ccw, means that the face is
     /// some `(..., i, j, ... )`.
-    const std::vector< Faces >& allEdgeLeftFaces() const 
+    const IndexRanges& allEdgeLeftFaces() const 
     { return myEdgeLeftFaces; }
     
     /// @}
@@ -918,7 +932,8 @@ namespace DGtal
        index of the flipped edge (if you reflip it you get your
        former configuration).
       
-       @note Time complexity is O(log n), due to the updating of
+       @note Time complexity is O(d), where d is the maximal number of
+       neighbors of the quad vertices, due to the updating of
        surrounding edges information.
       
        @warning For performance reasons, The neighbor faces of each
@@ -929,8 +944,20 @@ namespace DGtal
        @warning Vertex normals are not recomputed, but face normals
        may be recomputed if asked for. The face normals are then the
        geometric normals of triangles.
+
+       @note A row of the tables (e.g. the neighbors of a vertex)
+       which outgrows its capacity is moved at the end of its table
+       with twice this capacity, leaving a hole (see CompressedRows).
+       The memory stays within about three times the largest sizes
+       reached by the rows, and one may call \ref compact after a
+       batch of flips to reclaim it.
     */
     void flip( const Edge e, bool recompute_face_normals = false );
+
+    /// Removes from the tables of the mesh the holes left by rows
+    /// which have grown, e.g. after a batch of flips (see
+    /// CompressedRows::compact). Row ranges are invalidated.
+    void compact();
     
     /// @}    
 
@@ -939,7 +966,9 @@ namespace DGtal
     /// @name Look-up table computation services
     /// @{
     
-    /// Computes neighboring information.
+    /// Computes neighboring information. Neighbor vertices and
+    /// neighbor faces are computed in parallel (see
+    /// ThreadPool::defaultPool) and sorted by increasing index.
     void computeNeighbors();
     /// Computes edge information.
     void computeEdges();
@@ -964,9 +993,9 @@ namespace DGtal
     // ------------------------- Protected Datas ------------------------------
   protected:
     /// For each face, its range of incident vertices
-    std::vector< Vertices >     myIncidentVertices;
+    IndexRanges                 myIncidentVertices;
     /// For each vertex, its range of incident faces
-    std::vector< Faces >        myIncidentFaces;
+    IndexRanges                 myIncidentFaces;
     /// For each vertex, its position
     std::vector< RealPoint >    myPositions;
     /// For each vertex, its normal vector
@@ -974,27 +1003,28 @@ namespace DGtal
     /// For each face, its normal vector
     std::vector< RealVector >   myFaceNormals;
     /// For each face, its range of neighbor faces (no particular order)
-    std::vector< Faces >        myNeighborFaces;
+    IndexRanges                 myNeighborFaces;
     /// For each vertex, its range of neighbor vertices (no particular order)
-    std::vector< Vertices >     myNeighborVertices;
+    IndexRanges                 myNeighborVertices;
+    /// For each vertex, the edges to its neighbor vertices (in the
+    /// same order as myNeighborVertices).
+    IndexRanges                 myNeighborEdges;
     /// For each edge, its two vertices
     std::vector< VertexPair >   myEdgeVertices;
-    /// For each vertex pair, its edge index.
-    std::map< VertexPair,Edge > myVertexPairEdge;
     /// For each edge, its faces (one, two, or more if non manifold)
-    std::vector< Faces >        myEdgeFaces;
+    IndexRanges                 myEdgeFaces;
     /// For each edge, its faces to its right  (zero if open, one, or more if
     /// non manifold).
     /// @note an edge is stored as a vertex pair (i,j), i < j. So a
     /// face to its right, being defined ccw, means that the face is
     /// some `(..., j, i, ... )`.
-    std::vector< Faces >        myEdgeRightFaces;
+    IndexRanges                 myEdgeRightFaces;
     /// For each edge, its faces to its left  (zero if open, one, or more if
     /// non manifold).
     /// @note an edge is stored as a vertex pair (i,j), i < j. So a
     /// face to its left, being defined ccw, means that the face is
     /// some `(..., i, j, ... )`.
-    std::vector< Faces >        myEdgeLeftFaces;
+    IndexRanges                 myEdgeLeftFaces;
 
     // ------------------------- Private Datas --------------------------------
   private:
@@ -1003,17 +1033,19 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   protected:
 
-    /// Removes the index \a i from the vector \a v.
-    /// @param[inout] v a vector of indices
+    /// Removes the index \a i from the row \a r of \a rows.
+    /// @param[inout] rows a table of indices
+    /// @param[in] r a row of \a rows
     /// @param[in] i an index
-    void removeIndex( std::vector< Index >& v, Index i )
+    void removeIndex( IndexRanges& rows, Index r, Index i )
     {
+      auto v = rows[ r ];
       const std::size_t n = v.size();
       for ( std::size_t j = 0; j < n; j++ )
 	if ( v[ j ] == i )
 	  {
 	    std::swap( v[ j ], v.back() );
-	    v.resize( n - 1 );
+	    rows.popBack( r );
 	    return;
 	  }
       trace.error() << "[SurfaceMesh::removeIndex] Index " << i
@@ -1022,12 +1054,14 @@ namespace DGtal
       std::cerr << std::endl;
     }
 
-    /// Replaces the index \a i with the index \a ri in the vector \a v.
-    /// @param[inout] v a vector of indices
+    /// Replaces the index \a i with the index \a ri in the row \a r of \a rows.
+    /// @param[inout] rows a table of indices
+    /// @param[in] r a row of \a rows
     /// @param[in] i an index
     /// @param[in] ri an index    
-    void replaceIndex( std::vector< Index >& v, Index i, Index ri )
+    void replaceIndex( IndexRanges& rows, Index r, Index i, Index ri )
     {
+      auto v = rows[ r ];
       const std::size_t n = v.size();
       for ( std::size_t j = 0; j < n; j++ )
 	if ( v[ j ] == i )
@@ -1041,12 +1075,45 @@ namespace DGtal
       std::cerr << std::endl;
     }
 
-    /// Adds the index \a i to the vector \a v.
-    /// @param[inout] v a vector of indices
+    /// Adds the index \a i to the row \a r of \a rows.
+    /// @param[inout] rows a table of indices
+    /// @param[in] r a row of \a rows
     /// @param[in] i an index
-    void addIndex( std::vector< Index >& v, Index i )
+    void addIndex( IndexRanges& rows, Index r, Index i )
+    {
+      rows.pushBack( r, i );
+    }
+
+    /// Removes the vertex \a j from the neighbors of vertex \a i,
+    /// together with the corresponding edge.
+    /// @param[in] i a vertex
+    /// @param[in] j a neighbor vertex of \a i
+    void removeNeighbor( Vertex i, Vertex j )
+    {
+      auto nv = myNeighborVertices[ i ];
+      auto ne = myNeighborEdges   [ i ];
+      const std::size_t n = nv.size();
+      for ( std::size_t k = 0; k < n; k++ )
+	if ( nv[ k ] == j )
+	  {
+	    std::swap( nv[ k ], nv.back() );
+	    std::swap( ne[ k ], ne.back() );
+	    myNeighborVertices.popBack( i );
+	    myNeighborEdges   .popBack( i );
+	    return;
+	  }
+      trace.error() << "[SurfaceMesh::removeNeighbor] Vertex " << j
+		    << " is not a neighbor of " << i << std::endl;
+    }
+
+    /// Adds the vertex \a j to the neighbors of vertex \a i, through edge \a e.
+    /// @param[in] i a vertex
+    /// @param[in] j a vertex
+    /// @param[in] e the edge (i,j) or (j,i)
+    void addNeighbor( Vertex i, Vertex j, Edge e )
     {
-      v.push_back( i );
+      myNeighborVertices.pushBack( i, j );
+      myNeighborEdges   .pushBack( i, e );
     }
     
 
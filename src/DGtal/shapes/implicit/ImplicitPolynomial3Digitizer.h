@@ -0,0 +1,282 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImplicitPolynomial3Digitizer.h
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module ImplicitPolynomial3Digitizer.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImplicitPolynomial3Digitizer_RECURSES)
+#error Recursive header files inclusion detected in ImplicitPolynomial3Digitizer.h
+#else // defined(ImplicitPolynomial3Digitizer_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImplicitPolynomial3Digitizer_RECURSES
+
+#if !defined ImplicitPolynomial3Digitizer_h
+/** Prevents repeated inclusion of headers. */
+#define ImplicitPolynomial3Digitizer_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ThreadPool.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/math/MPolynomial.h"
+#include "DGtal/math/CompiledMPolynomial3.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerByIntervals.h"
+#include "DGtal/shapes/implicit/ImplicitPolynomial3Shape.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImplicitPolynomial3Digitizer
+  /**
+     Description of template class 'ImplicitPolynomial3Digitizer' <p>
+     \brief Aim: Computes the Gauss digitization of an
+     ImplicitPolynomial3Shape into an image, much faster than
+     evaluating GaussDigitizer at every point of the domain.
+
+     The polynomial is compiled into a CompiledMPolynomial3. The
+     domain is cut into blocks of 64x8x8 points. For each block, an
+     interval enclosing the polynomial values is computed: blocks
+     that are certainly inside or outside the shape are filled
+     without any evaluation. The remaining blocks are split along \a
+     y and \a z down to rows of points along \a x, which are
+     themselves split along \a x with the same test. Only short
+     segments close to the zero level set are evaluated point by
+     point, with the vectorized row evaluation of
+     CompiledMPolynomial3. Slabs of blocks are processed in parallel
+     with the default ThreadPool. The result is written either in a
+     dense image (e.g. bit-packed with bool values) or in an
+     ImageContainerByIntervals, in which case the dense image is never
+     built.
+
+     The result is exactly the one of GaussDigitizer: a point \a p is
+     inside iff the polynomial value at its embedding \f$ (p_0 h_0,
+     p_1 h_1, p_2 h_2) \f$ is not positive.
+
+     @code
+     typedef ImplicitPolynomial3Digitizer<Z3i::Space> Digitizer;
+     ImageContainerBySTLVector<Z3i::Domain, bool> image( domain );
+     Digitizer digitizer( shape, Z3i::RealVector::diagonal( 0.1 ) );
+     digitizer.digitize( image );
+     @endcode
+
+     @tparam TSpace the digital space, of dimension 3.
+  */
+  template <typename TSpace>
+  class ImplicitPolynomial3Digitizer
+  {
+  public:
+    typedef ImplicitPolynomial3Digitizer<TSpace> Self;
+    typedef TSpace Space;
+    typedef typename Space::Integer Integer;
+    typedef typename Space::Point Point;
+    typedef typename Space::RealPoint RealPoint;
+    typedef typename Space::RealVector RealVector;
+    typedef HyperRectDomain<Space> Domain;
+    typedef typename Domain::Size Size;
+    typedef ImplicitPolynomial3Shape<Space> ImplicitShape;
+    typedef typename ImplicitShape::Ring Ring;
+    typedef typename ImplicitShape::Polynomial3 Polynomial3;
+    typedef CompiledMPolynomial3<Ring> CompiledPolynomial;
+    typedef typename CompiledPolynomial::Interval Interval;
+
+    BOOST_STATIC_ASSERT(( Space::dimension == 3 ));
+
+    /// The size of blocks along x.
+    static constexpr Size BLOCK_WIDTH  = 64;
+    /// The size of blocks along y and z.
+    static constexpr Size BLOCK_HEIGHT = 8;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+       Constructor.
+       @param poly the polynomial defining the shape {x, poly(x) <= 0}.
+       @param gridSteps the grid steps in each direction.
+    */
+    ImplicitPolynomial3Digitizer( const Polynomial3 & poly,
+                                  const RealVector & gridSteps );
+
+    /**
+       Constructor.
+       @param shape any implicit polynomial shape.
+       @param gridSteps the grid steps in each direction.
+    */
+    ImplicitPolynomial3Digitizer( const ImplicitShape & shape,
+                                  const RealVector & gridSteps );
+
+    // ----------------------- Digitization services --------------------------
+  public:
+
+    /**
+       Digitizes the shape in the domain of the given image: each
+       point is set to the value 'true' (converted to TValue) if it
+       is inside the shape, 'false' otherwise.
+
+       @tparam TValue the type of the image values (e.g. bool).
+       @param[in,out] image any image, whose values are all set.
+       @return the number of points at which the polynomial was evaluated.
+    */
+    template <typename TValue>
+    Size digitize( ImageContainerBySTLVector<Domain, TValue> & image ) const;
+
+    /**
+       Digitizes the shape in the domain of the given image, whose
+       runs are replaced by the runs of points inside the shape.
+
+       @param[in,out] image any image by intervals.
+       @return the number of points at which the polynomial was evaluated.
+    */
+    Size digitize( ImageContainerByIntervals<Domain> & image ) const;
+
+    /// @return the compiled polynomial.
+    const CompiledPolynomial & compiledPolynomial() const;
+
+    /// @return the grid steps in each direction.
+    const RealVector & gridSteps() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The compiled polynomial.
+    CompiledPolynomial myPolynomial;
+    /// The grid steps.
+    RealVector myGridSteps;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+       @param k any dimension.
+       @param a any integer coordinate.
+       @return the embedding of the coordinate \a a along axis \a k.
+    */
+    Ring embed( Dimension k, Integer a ) const;
+
+    /**
+       @param k any dimension.
+       @param a any integer coordinate.
+       @param b any integer coordinate, b >= a.
+       @return the interval containing the embeddings of a..b along axis \a k.
+    */
+    Interval embed( Dimension k, Integer a, Integer b ) const;
+
+    /**
+       @param domain any domain.
+       @return the number of slabs of blocks of the domain along z.
+    */
+    Size nbSlabs( const Domain & domain ) const;
+
+    /**
+       Digitizes the slab \a s of the domain, whose values are
+       contiguous, ordered as in the image, from \a values.
+
+       @tparam TIterator a random access iterator on values convertible from bool.
+       @param values an iterator on the value of the first point of the slab.
+       @param domain the domain.
+       @param s the index of the slab.
+       @return the number of points at which the polynomial was evaluated.
+    */
+    template <typename TIterator>
+    Size digitizeSlab( TIterator values, const Domain & domain, Size s ) const;
+
+    /**
+       Digitizes the block [lo,hi[ (in coordinates relative to the
+       lower bound of the domain). Blocks close to the zero level set
+       are split along y and z down to rows.
+
+       @param values an iterator on the value of the first point of the slab.
+       @param domain the domain.
+       @param z0 the relative z-coordinate of the first point of the slab.
+       @param lo the lowest point of the block.
+       @param hi the point after the highest point of the block.
+       @param x the embedded abscissas of the block.
+       @return the number of points at which the polynomial was evaluated.
+    */
+    template <typename TIterator>
+    Size digitizeBlock( TIterator values, const Domain & domain, Integer z0,
+                        const Point & lo, const Point & hi, const Ring* x ) const;
+
+    /**
+       Digitizes a segment of a row. Segments close to the zero level
+       set are split until they are short enough to be evaluated.
+
+       @param values an iterator on the value of the first point of the slab.
+       @param coefficients the coefficients of the row polynomial in x.
+       @param first the index of the first point of the segment from \a values.
+       @param x the embedded abscissas of the segment.
+       @param n the number of points of the segment.
+       @return the number of points at which the polynomial was evaluated.
+    */
+    template <typename TIterator>
+    Size digitizeRow( TIterator values, const Ring* coefficients,
+                      Size first, const Ring* x, Size n ) const;
+
+  }; // end of class ImplicitPolynomial3Digitizer
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImplicitPolynomial3Digitizer'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImplicitPolynomial3Digitizer' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const ImplicitPolynomial3Digitizer<TSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/shapes/implicit/ImplicitPolynomial3Digitizer.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImplicitPolynomial3Digitizer_h
+
+#undef ImplicitPolynomial3Digitizer_RECURSES
+#endif // else defined(ImplicitPolynomial3Digitizer_RECURSES)
@@ -107,6 +107,11 @@ namespace DGtal
     */
     void init( const Polynomial3 & poly );
 
+    /**
+       @return the polynomial defining the implicit shape.
+    */
+    const Polynomial3 & polynomial() const;
+
     // ----------------------- Interface --------------------------------------
   public:
 
@@ -167,7 +167,10 @@ namespace DGtal
   * it. It could be for instance a std::map or a
   * std::unordered_map. Note that unfortunately, unordered_map are
   * (strangely) not models of boost::AssociativeContainer, hence we
-  * cannot check concepts here.
+  * cannot check concepts here. For complexes filling a good part of
+  * a bounded space, DenseCellMap stores cells in flat arrays indexed
+  * by their Khalimsky coordinates, which avoids the tree or hash
+  * lookups of the other containers.
   *
   */
   template < typename TKSpace,
@@ -540,7 +543,9 @@ namespace DGtal
 
     /**
     * Constructor of empty complex. Needs a space to represents
-    * cubical cells.
+    * cubical cells. Cell containers with a method `init( K, d )`
+    * (e.g. DenseCellMap) are initialized with the space and the
+    * dimension of their cells.
     *
     * @param aK a Khalimsky space.
     */
@@ -0,0 +1,484 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DenseCellMap.h
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module DenseCellMap.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DenseCellMap_RECURSES)
+#error Recursive header files inclusion detected in DenseCellMap.h
+#else // defined(DenseCellMap_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DenseCellMap_RECURSES
+
+#if !defined DenseCellMap_h
+/** Prevents repeated inclusion of headers. */
+#define DenseCellMap_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/ContainerTraits.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DenseCellMap
+  /**
+   * Description of template class 'DenseCellMap' <p>
+   * \brief Aim: An associative container mapping the cells of a given
+   * dimension of a bounded KhalimskySpaceND to some data, stored in
+   * flat arrays indexed by the Khalimsky coordinates of the cells.
+   *
+   * Each cell of the dimension has a slot in an array of data, and a
+   * bit in an array of occupancy words. Finding, inserting or erasing
+   * a cell is thus a few arithmetic operations on its coordinates,
+   * instead of a tree or hash lookup, and the memory is known in
+   * advance: one Data plus one bit per cell of the dimension in the
+   * space, whatever the number of cells in the map.
+   *
+   * It is meant as the cell container of CubicalComplex (and thus of
+   * VoxelComplex) on dense data, i.e. when the complex fills a good
+   * part of a bounded space:
+   * @code
+   * typedef DenseCellMap< KSpace, CubicalCellData > CellMap;
+   * typedef CubicalComplex< KSpace, CellMap > CC;
+   * CC complex( K ); // each cell map is initialized with K and its dimension.
+   * @endcode
+   *
+   * The map has the interface of an unordered std::map: it is a model
+   * of concepts::CSTLAssociativeContainer and is seen as a pair
+   * associative unordered container by ContainerTraits, so that set
+   * operations of functions::setops apply. Cells are enumerated in
+   * the order of their index. Dereferencing an iterator gives a proxy
+   * whose members \a first and \a second are references to the cell
+   * (stored in the iterator) and to its data. Iterators are not
+   * invalidated by insertions or erasures of other cells.
+   *
+   * The storage is allocated at the first insertion from the bounds
+   * the space has at that time, and released by clear(). It is thus
+   * possible to build the map (or the complex) before initializing
+   * the space.
+   *
+   * @tparam TKSpace any KhalimskySpaceND.
+   * @tparam TData the type of data associated to each cell, e.g.
+   * CubicalCellData.
+   *
+   * @see CubicalComplex, testDenseCellMap.cpp
+   */
+  template <typename TKSpace, typename TData>
+  class DenseCellMap
+  {
+  public:
+    typedef DenseCellMap<TKSpace, TData> Self;
+    typedef TKSpace KSpace;
+    typedef TData Data;
+    typedef typename KSpace::Cell Cell;
+    typedef typename KSpace::Point Point;
+    typedef typename KSpace::Integer Integer;
+    static const Dimension dimension = KSpace::dimension;
+
+    typedef Cell key_type;
+    typedef Data mapped_type;
+    typedef std::pair<const Cell, Data> value_type;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    /**
+     * What an iterator points to: a cell and a reference to its data.
+     * @tparam TDataRef Data& or const Data&.
+     */
+    template <typename TDataRef>
+    struct ReferenceProxy
+    {
+      const Cell & first;
+      TDataRef second;
+      /// Conversion to value_type, or any pair of cell and data.
+      template <typename TCell, typename TOtherData>
+      operator std::pair<TCell, TOtherData>() const
+      {
+        return std::pair<TCell, TOtherData>( first, second );
+      }
+    };
+
+    /**
+     * Forward iterator on the cells of the map.
+     * @tparam TMap DenseCellMap or const DenseCellMap.
+     * @tparam TDataRef Data& or const Data&.
+     */
+    template <typename TMap, typename TDataRef>
+    class IteratorBase
+    {
+    public:
+      typedef std::forward_iterator_tag iterator_category;
+      typedef typename DenseCellMap::value_type value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef ReferenceProxy<TDataRef> reference;
+      /// Gives access to the members of the proxy reference.
+      struct pointer
+      {
+        reference ref;
+        const reference * operator->() const { return &ref; }
+      };
+
+      IteratorBase() : myMap( nullptr ), myIndex( 0 ) {}
+
+      IteratorBase( TMap * aMap, size_type i )
+        : myMap( aMap ), myIndex( i )
+      {
+        if ( myIndex < myMap->capacity() ) myCell = myMap->cell( myIndex );
+      }
+
+      /// Conversion from iterator to const_iterator.
+      template <typename TOtherMap, typename TOtherDataRef>
+      IteratorBase( const IteratorBase<TOtherMap, TOtherDataRef> & other )
+        : myMap( other.map() ), myIndex( other.index() ), myCell( other.myCell )
+      {}
+
+      reference operator*() const
+      {
+        return reference{ myCell, myMap->myData[ myIndex ] };
+      }
+
+      pointer operator->() const
+      {
+        return pointer{ **this };
+      }
+
+      IteratorBase & operator++()
+      {
+        myIndex = myMap->nextIndex( myIndex + 1 );
+        if ( myIndex < myMap->capacity() ) myCell = myMap->cell( myIndex );
+        return *this;
+      }
+
+      IteratorBase operator++( int )
+      {
+        IteratorBase tmp( *this );
+        ++( *this );
+        return tmp;
+      }
+
+      bool operator==( const IteratorBase & other ) const
+      {
+        return myIndex == other.myIndex;
+      }
+
+      bool operator!=( const IteratorBase & other ) const
+      {
+        return myIndex != other.myIndex;
+      }
+
+      /// @return the map of the iterator.
+      TMap * map() const { return myMap; }
+
+      /// @return the index of the pointed cell.
+      size_type index() const { return myIndex; }
+
+    private:
+      template <typename TOtherMap, typename TOtherDataRef>
+      friend class IteratorBase;
+
+      /// The map.
+      TMap * myMap;
+      /// The index of the pointed cell, or capacity() for end().
+      size_type myIndex;
+      /// The pointed cell.
+      Cell myCell;
+    };
+
+    typedef IteratorBase<Self, Data&> iterator;
+    typedef IteratorBase<const Self, const Data&> const_iterator;
+    typedef typename iterator::reference reference;
+    typedef typename const_iterator::reference const_reference;
+    typedef typename iterator::pointer pointer;
+    typedef typename const_iterator::pointer const_pointer;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Default constructor. The map is empty and can't receive cells
+     * until init() is called.
+     */
+    DenseCellMap() = default;
+
+    /**
+     * Constructor. The map is empty.
+     *
+     * @param aKSpace the space of the cells.
+     * @param d the dimension of the cells of the map.
+     */
+    DenseCellMap( ConstAlias<KSpace> aKSpace, Dimension d );
+
+    /**
+     * Associates the map to a space and a dimension of cells, and
+     * removes all its cells.
+     *
+     * @param aKSpace the space of the cells.
+     * @param d the dimension of the cells of the map.
+     */
+    void init( ConstAlias<KSpace> aKSpace, Dimension d );
+
+    // ----------------------- Container services -----------------------------
+  public:
+
+    /// @return the number of cells.
+    size_type size() const;
+
+    /// @return 'true' if the map is empty.
+    bool empty() const;
+
+    /// @return the maximal number of cells.
+    size_type max_size() const;
+
+    /// @return the number of cells of the dimension in the space (0 before the first insertion).
+    size_type capacity() const;
+
+    /// Removes all the cells and releases the storage.
+    void clear();
+
+    /// @param other the map exchanged with this one.
+    void swap( DenseCellMap & other );
+
+    /// @return an iterator on the first cell.
+    iterator begin();
+
+    /// @return an iterator after the last cell.
+    iterator end();
+
+    /// @return an iterator on the first cell.
+    const_iterator begin() const;
+
+    /// @return an iterator after the last cell.
+    const_iterator end() const;
+
+    /**
+     * Inserts a cell with its data, if it is not already in the map.
+     * @param value a cell of the dimension of the map, and its data.
+     * @return an iterator on the cell and 'true' if it was inserted,
+     * or end() and 'false' if the cell is outside the bounds of the
+     * space or not of the dimension of the map.
+     */
+    std::pair<iterator, bool> insert( const value_type & value );
+
+    /**
+     * Inserts a cell with its data, if it is not already in the map.
+     * @param hint unused.
+     * @param value a cell of the dimension of the map, and its data.
+     * @return an iterator on the cell, or end() if it can't be inserted.
+     */
+    iterator insert( const_iterator hint, const value_type & value );
+
+    /**
+     * Inserts a range of cells with their data.
+     * @tparam TInputIterator an iterator on value_type.
+     * @param first an iterator on the first value.
+     * @param last an iterator after the last value.
+     */
+    template <typename TInputIterator>
+    void insert( TInputIterator first, TInputIterator last );
+
+    /**
+     * @param aCell a cell of the dimension of the map.
+     * @return a reference to its data, the cell being inserted with
+     * Data() if it was not in the map.
+     * @throw std::out_of_range if the cell is outside the bounds of
+     * the space or not of the dimension of the map.
+     */
+    Data & operator[]( const Cell & aCell );
+
+    /**
+     * @param aCell any cell.
+     * @return the number of removed cells (0 or 1).
+     */
+    size_type erase( const Cell & aCell );
+
+    /**
+     * @param position an iterator on a cell of the map.
+     * @return an iterator on the next cell.
+     */
+    iterator erase( const_iterator position );
+
+    /**
+     * @param first an iterator on the first cell to erase.
+     * @param last an iterator after the last cell to erase.
+     * @return @a last.
+     */
+    iterator erase( const_iterator first, const_iterator last );
+
+    /**
+     * @param aCell any cell.
+     * @return an iterator on the cell, or end() if it is not in the map.
+     */
+    iterator find( const Cell & aCell );
+
+    /**
+     * @param aCell any cell.
+     * @return an iterator on the cell, or end() if it is not in the map.
+     */
+    const_iterator find( const Cell & aCell ) const;
+
+    /**
+     * @param aCell any cell.
+     * @return 1 if the cell is in the map, 0 otherwise.
+     */
+    size_type count( const Cell & aCell ) const;
+
+    /**
+     * @param aCell any cell.
+     * @return the range of the cells equal to @a aCell.
+     */
+    std::pair<iterator, iterator> equal_range( const Cell & aCell );
+
+    /**
+     * @param aCell any cell.
+     * @return the range of the cells equal to @a aCell.
+     */
+    std::pair<const_iterator, const_iterator> equal_range( const Cell & aCell ) const;
+
+    // ----------------------- Index services ---------------------------------
+  public:
+
+    /**
+     * @param aCell any cell.
+     * @return its index in the arrays of the map, or capacity() if it
+     * is not a cell of the dimension of the map within the bounds of
+     * the space.
+     */
+    size_type index( const Cell & aCell ) const;
+
+    /**
+     * @param i an index smaller than capacity().
+     * @return the cell of index @a i.
+     */
+    Cell cell( size_type i ) const;
+
+    /**
+     * @param i any index.
+     * @return the index of the first cell of the map whose index is
+     * greater or equal to @a i, or capacity() if there is none.
+     */
+    size_type nextIndex( size_type i ) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// Allocates the arrays from the current bounds of the space.
+    void allocate();
+
+    /// @param i an index smaller than capacity().
+    /// @return 'true' if the cell of index @a i is in the map.
+    bool isOccupied( size_type i ) const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The space of the cells.
+    const KSpace * myKSpace = nullptr;
+
+    /// The dimension of the cells.
+    Dimension myDim = 0;
+
+    /// The Khalimsky coordinates of the first even (0) and odd (1)
+    /// cells along each axis.
+    Point myFirst[ 2 ];
+
+    /// The number of even (0) and odd (1) Khalimsky coordinates along
+    /// each axis.
+    Point myExtent[ 2 ];
+
+    /// For each parity pattern of the coordinates (bit k is the
+    /// parity of coordinate k), the index of its first cell, or
+    /// capacity() if its cells do not have the dimension of the map.
+    std::vector<size_type> myPatternOffsets;
+
+    /// The parity patterns of the cells of the map, by increasing offset.
+    std::vector<unsigned int> myPatterns;
+
+    /// The data of each cell.
+    std::vector<Data> myData;
+
+    /// The occupancy of each cell, one bit per cell.
+    std::vector<DGtal::uint64_t> myOccupancy;
+
+    /// The number of cells in the map.
+    size_type mySize = 0;
+
+  }; // end of class DenseCellMap
+
+  /**
+   * Specialization of ContainerTraits for DenseCellMap, an unordered
+   * pair associative container.
+   */
+  template <typename TKSpace, typename TData>
+  struct ContainerTraits< DenseCellMap< TKSpace, TData > >
+  {
+    typedef UnorderedMapAssociativeCategory Category;
+  };
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DenseCellMap'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DenseCellMap' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace, typename TData>
+  std::ostream&
+  operator<< ( std::ostream & out, const DenseCellMap<TKSpace, TData> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/DenseCellMap.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DenseCellMap_h
+
+#undef DenseCellMap_RECURSES
+#endif // else defined(DenseCellMap_RECURSES)
@@ -41,6 +41,7 @@
 #include <iostream>
 #include "DGtal/base/Common.h"
 #include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/PackedKhalimskyCell.h"
 #include <boost/functional/hash.hpp>
 //////////////////////////////////////////////////////////////////////////////
 
@@ -80,6 +81,38 @@ namespace std {
     }
   };
 
+  /** @brief
+   * Extend std namespace to define a std::hash function on
+   * DGtal::PackedKhalimskyCell. The bits of the code are mixed since
+   * packed coordinates only use the lower bits.
+   *
+   */
+  template <>
+  struct hash< DGtal::PackedKhalimskyCell >
+  {
+    size_t operator()(const DGtal::PackedKhalimskyCell & pc) const
+    {
+      DGtal::uint64_t h = pc.code;
+      h ^= h >> 33; h *= 0xff51afd7ed558ccdULL;
+      h ^= h >> 33; h *= 0xc4ceb9fe1a85ec53ULL;
+      return (size_t) ( h ^ ( h >> 33 ) );
+    }
+  };
+
+  /** @brief
+   * Extend std namespace to define a std::hash function on
+   * DGtal::PackedSignedKhalimskyCell.
+   *
+   */
+  template <>
+  struct hash< DGtal::PackedSignedKhalimskyCell >
+  {
+    size_t operator()(const DGtal::PackedSignedKhalimskyCell & pc) const
+    {
+      return hash< DGtal::PackedKhalimskyCell >()( DGtal::PackedKhalimskyCell{ pc.code } );
+    }
+  };
+
 }
 
 namespace boost{
@@ -117,6 +150,34 @@ namespace boost{
     }
   };
 
+  /** @brief
+   * Extend boost namespace to define a boost::hash function on
+   * DGtal::PackedKhalimskyCell.
+   *
+   */
+  template <>
+  struct hash< DGtal::PackedKhalimskyCell >
+  {
+    size_t operator()(const DGtal::PackedKhalimskyCell & pc) const
+    {
+      return std::hash< DGtal::PackedKhalimskyCell >()( pc );
+    }
+  };
+
+  /** @brief
+   * Extend boost namespace to define a boost::hash function on
+   * DGtal::PackedSignedKhalimskyCell.
+   *
+   */
+  template <>
+  struct hash< DGtal::PackedSignedKhalimskyCell >
+  {
+    size_t operator()(const DGtal::PackedSignedKhalimskyCell & pc) const
+    {
+      return std::hash< DGtal::PackedSignedKhalimskyCell >()( pc );
+    }
+  };
+
 }
 
 
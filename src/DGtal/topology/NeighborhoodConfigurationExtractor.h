@@ -0,0 +1,219 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file NeighborhoodConfigurationExtractor.h
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module NeighborhoodConfigurationExtractor.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(NeighborhoodConfigurationExtractor_RECURSES)
+#error Recursive header files inclusion detected in NeighborhoodConfigurationExtractor.h
+#else // defined(NeighborhoodConfigurationExtractor_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define NeighborhoodConfigurationExtractor_RECURSES
+
+#if !defined NeighborhoodConfigurationExtractor_h
+/** Prevents repeated inclusion of headers. */
+#define NeighborhoodConfigurationExtractor_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <type_traits>
+#include <vector>
+#include "boost/dynamic_bitset.hpp"
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/topology/helpers/NeighborhoodConfigurationsHelper.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class NeighborhoodConfigurationExtractor
+  /**
+   * Description of template class 'NeighborhoodConfigurationExtractor' <p>
+   * \brief Aim: Computes the neighborhood configurations (see
+   * NeighborhoodConfigurations.h) of the points of a binary image,
+   * i.e. the occupancy of their 8 (2D) or 26 (3D) neighbors as a
+   * NeighborhoodConfiguration, to be used with the precomputed
+   * simplicity and isthmusicity tables (see functions::loadTable).
+   *
+   * A point is in the object if its value in the image converts to
+   * 'true'. Points outside the image domain are not in the object.
+   *
+   * The configurations of a row of consecutive points along the
+   * first axis are computed together: the occupancy of the 3 x 3 (3D)
+   * or 3 (2D) lines of the neighborhood are shifted by one bit from
+   * one point to the next, so that each value of the image is read
+   * once per line. When the image is an ImageContainerBySTLVector
+   * (including the bit-packed ImageContainerBySTLVector<Domain,bool>),
+   * values are read from their linear index instead of their point.
+   *
+   * @code
+   * ImageContainerBySTLVector< Z3i::Domain, bool > image( domain );
+   * ...
+   * auto table = functions::loadTable( simplicity::tableSimple26_6 );
+   * NeighborhoodConfigurationExtractor< decltype( image ) > extractor( image );
+   * bool simple = extractor.lookup( *table, p );
+   * std::vector<bool> simples;
+   * extractor.classify( *table, rowStart, rowLength, std::back_inserter( simples ) );
+   * @endcode
+   *
+   * @tparam TImage any 2D or 3D image whose values convert to bool.
+   *
+   * @see functions::mapZeroPointNeighborhoodToConfigurationMask,
+   * testNeighborhoodConfigurations.cpp
+   */
+  template <typename TImage>
+  class NeighborhoodConfigurationExtractor
+  {
+  public:
+    typedef TImage Image;
+    typedef typename Image::Domain Domain;
+    typedef typename Image::Point Point;
+    typedef typename Image::Value Value;
+    typedef typename Point::Coordinate Integer;
+    typedef std::size_t Size;
+    typedef boost::dynamic_bitset<> Table;
+    static const Dimension dimension = Domain::dimension;
+    BOOST_STATIC_ASSERT(( dimension == 2 || dimension == 3 ));
+
+    /// The number of lines of 3 points along the first axis in the neighborhood.
+    static const unsigned int nbLines = dimension == 2 ? 3 : 9;
+
+    /// 'true' if the values of the image can be read by linear index.
+    static const bool isLinear = std::is_base_of< std::vector<Value>, Image >::value;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param anImage the binary image.
+     */
+    NeighborhoodConfigurationExtractor( ConstAlias<Image> anImage );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @param p any point of the domain.
+     * @return the neighborhood configuration of @a p.
+     */
+    NeighborhoodConfiguration configuration( const Point & p ) const;
+
+    /**
+     * Computes the neighborhood configurations of the @a n points
+     * @a first, @a first + (1,0,...), ..., which must be in the domain.
+     *
+     * @tparam TOutputIterator an output iterator on NeighborhoodConfiguration.
+     * @param first the first point of the row.
+     * @param n the number of points.
+     * @param out the output iterator receiving the configurations.
+     */
+    template <typename TOutputIterator>
+    void configurations( const Point & first, Size n, TOutputIterator out ) const;
+
+    /**
+     * @param table a table of dimension 2 or 3 (see functions::loadTable),
+     * e.g. simplicity::tableSimple26_6 or isthmusicity::tableIsthmus.
+     * @param p any point of the domain.
+     * @return the value of the table for the configuration of @a p.
+     */
+    bool lookup( const Table & table, const Point & p ) const;
+
+    /**
+     * Classifies a row of points with a table.
+     *
+     * @tparam TOutputIterator an output iterator on bool.
+     * @param table a table of dimension 2 or 3 (see functions::loadTable).
+     * @param first the first point of the row.
+     * @param n the number of points.
+     * @param out the output iterator receiving the value of the table
+     * for the configuration of each point.
+     */
+    template <typename TOutputIterator>
+    void classify( const Table & table, const Point & first, Size n,
+                   TOutputIterator out ) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param inside 'true' if the line is in the domain.
+     * @param base the point of the line at the first point of the row.
+     * @param linearBase the linear index of @a base.
+     * @param dx the offset from @a base along the first axis.
+     * @return 1 if the point is in the object, 0 otherwise.
+     */
+    unsigned int lineValue( bool inside, const Point & base, Size linearBase,
+                            Integer dx ) const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The binary image.
+    const Image * myImage;
+
+  }; // end of class NeighborhoodConfigurationExtractor
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'NeighborhoodConfigurationExtractor'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'NeighborhoodConfigurationExtractor' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImage>
+  std::ostream&
+  operator<< ( std::ostream & out, const NeighborhoodConfigurationExtractor<TImage> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/NeighborhoodConfigurationExtractor.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined NeighborhoodConfigurationExtractor_h
+
+#undef NeighborhoodConfigurationExtractor_RECURSES
+#endif // else defined(NeighborhoodConfigurationExtractor_RECURSES)
@@ -0,0 +1,271 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PackedKhalimskyCell.h
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module PackedKhalimskyCell.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(PackedKhalimskyCell_RECURSES)
+#error Recursive header files inclusion detected in PackedKhalimskyCell.h
+#else // defined(PackedKhalimskyCell_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PackedKhalimskyCell_RECURSES
+
+#if !defined PackedKhalimskyCell_h
+/** Prevents repeated inclusion of headers. */
+#define PackedKhalimskyCell_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <array>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  /**
+   * @brief Represents an unsigned cell of a bounded KhalimskySpaceND
+   * as a single 64 bits integer (see KhalimskyCellPacker).
+   *
+   * Packed cells are compared and hashed as integers (see
+   * KhalimskyCellHashFunctions.h). Their order is not the order of
+   * KhalimskyCell.
+   */
+  struct PackedKhalimskyCell
+  {
+    /// The packed Khalimsky coordinates.
+    DGtal::uint64_t code;
+
+    bool operator==( const PackedKhalimskyCell & other ) const { return code == other.code; }
+    bool operator!=( const PackedKhalimskyCell & other ) const { return code != other.code; }
+    bool operator<( const PackedKhalimskyCell & other ) const  { return code < other.code; }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  /**
+   * @brief Represents a signed cell of a bounded KhalimskySpaceND as
+   * a single 64 bits integer (see KhalimskyCellPacker).
+   *
+   * Packed cells are compared and hashed as integers (see
+   * KhalimskyCellHashFunctions.h). Their order is not the order of
+   * SignedKhalimskyCell.
+   */
+  struct PackedSignedKhalimskyCell
+  {
+    /// The packed Khalimsky coordinates and sign (lowest bit).
+    DGtal::uint64_t code;
+
+    bool operator==( const PackedSignedKhalimskyCell & other ) const { return code == other.code; }
+    bool operator!=( const PackedSignedKhalimskyCell & other ) const { return code != other.code; }
+    bool operator<( const PackedSignedKhalimskyCell & other ) const  { return code < other.code; }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class KhalimskyCellPacker
+  /**
+   * Description of template class 'KhalimskyCellPacker' <p>
+   * \brief Aim: Converts the cells of a bounded KhalimskySpaceND to
+   * and from single 64 bits integers (PackedKhalimskyCell and
+   * PackedSignedKhalimskyCell).
+   *
+   * A cell of the space has its Khalimsky coordinates between those
+   * of lowerCell() and upperCell(). Each coordinate is thus stored
+   * with \f$ \lceil \log_2(u_k - l_k + 1) \rceil \f$ bits, after the
+   * sign bit. For instance, a 3D space of \f$ 2^{20} \f$ voxels along
+   * each axis needs 1 + 3 * 21 = 64 bits. Packed cells are 8 bytes
+   * long and hashed or compared in a single operation, instead of a
+   * PointVector and a sign, which makes sets and maps of cells (see
+   * PackedSurfelSet) smaller and faster.
+   *
+   * @code
+   * KSpace K;
+   * K.init( lower, upper, true );
+   * KhalimskyCellPacker< KSpace > packer( K );
+   * if ( packer.isValid() )
+   * {
+   *   PackedSignedKhalimskyCell ps = packer.pack( s );
+   *   ASSERT( packer.unpack( ps ) == s );
+   * }
+   * @endcode
+   *
+   * @tparam TKSpace a KhalimskySpaceND.
+   *
+   * @note The packer refers to the space, which must exist as long
+   * as the packer is used.
+   *
+   * @see PackedSurfelSet, testPackedKhalimskyCell.cpp
+   */
+  template <typename TKSpace>
+  class KhalimskyCellPacker
+  {
+  public:
+    typedef TKSpace KSpace;
+    typedef typename KSpace::Cell Cell;
+    typedef typename KSpace::SCell SCell;
+    typedef typename KSpace::Point Point;
+    typedef typename KSpace::Integer Integer;
+    typedef PackedKhalimskyCell PackedCell;
+    typedef PackedSignedKhalimskyCell PackedSCell;
+    static const Dimension dimension = KSpace::dimension;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Default constructor. The object is not valid.
+     */
+    KhalimskyCellPacker();
+
+    /**
+     * Constructor.
+     *
+     * @param aKSpace the space whose cells are packed.
+     * @see init
+     */
+    KhalimskyCellPacker( ConstAlias<KSpace> aKSpace );
+
+    /**
+     * Initializes the packer for the cells of a space.
+     *
+     * @param aKSpace the space whose cells are packed.
+     * @return 'true' if the cells of @a aKSpace fit in 64 bits,
+     * 'false' otherwise (the object is then not valid).
+     */
+    bool init( ConstAlias<KSpace> aKSpace );
+
+    /**
+     * @param aKSpace any space.
+     * @return the number of bits of the packed cells of @a aKSpace
+     * (sign included).
+     */
+    static unsigned int nbBits( const KSpace & aKSpace );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /// @return the space whose cells are packed.
+    const KSpace & space() const;
+
+    /// @return the number of bits used by packed cells (sign included).
+    unsigned int nbBits() const;
+
+    /**
+     * @param c any cell of the space.
+     * @return the packed cell.
+     * @pre `space().uIsInside( c )`, otherwise the coordinates
+     * overflow into each other.
+     */
+    PackedCell pack( const Cell & c ) const;
+
+    /**
+     * @param c any signed cell of the space.
+     * @return the packed signed cell.
+     * @pre `space().sIsInside( c )`, otherwise the coordinates
+     * overflow into each other.
+     */
+    PackedSCell pack( const SCell & c ) const;
+
+    /**
+     * @param pc a cell returned by pack.
+     * @return the corresponding cell.
+     */
+    Cell unpack( const PackedCell & pc ) const;
+
+    /**
+     * @param pc a signed cell returned by pack.
+     * @return the corresponding signed cell.
+     */
+    SCell unpack( const PackedSCell & pc ) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// @return the packed Khalimsky coordinates, shifted by one bit.
+    DGtal::uint64_t packCoordinates( const Point & kp ) const;
+
+    /// @return the Khalimsky coordinates of a packed cell.
+    Point unpackCoordinates( DGtal::uint64_t code ) const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The space whose cells are packed.
+    const KSpace * myKSpace;
+
+    /// The Khalimsky coordinates of the lower cell of the space.
+    Point myLower;
+
+    /// The position of the first bit of each coordinate.
+    std::array<unsigned int, dimension> myShift;
+
+    /// The mask of each coordinate, once shifted.
+    std::array<DGtal::uint64_t, dimension> myMask;
+
+    /// The number of bits of packed cells.
+    unsigned int myNbBits;
+
+  }; // end of class KhalimskyCellPacker
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'KhalimskyCellPacker'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'KhalimskyCellPacker' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const KhalimskyCellPacker<TKSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/PackedKhalimskyCell.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PackedKhalimskyCell_h
+
+#undef PackedKhalimskyCell_RECURSES
+#endif // else defined(PackedKhalimskyCell_RECURSES)
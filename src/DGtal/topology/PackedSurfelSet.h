@@ -0,0 +1,245 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PackedSurfelSet.h
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module PackedSurfelSet.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(PackedSurfelSet_RECURSES)
+#error Recursive header files inclusion detected in PackedSurfelSet.h
+#else // defined(PackedSurfelSet_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PackedSurfelSet_RECURSES
+
+#if !defined PackedSurfelSet_h
+/** Prevents repeated inclusion of headers. */
+#define PackedSurfelSet_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <unordered_set>
+#include <utility>
+#include <boost/iterator/transform_iterator.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/topology/PackedKhalimskyCell.h"
+#include "DGtal/topology/KhalimskyCellHashFunctions.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PackedSurfelSet
+  /**
+   * Description of template class 'PackedSurfelSet' <p>
+   * \brief Aim: A set of signed cells of a bounded KhalimskySpaceND,
+   * stored as packed 64 bits integers (see KhalimskyCellPacker) in a
+   * hash set.
+   *
+   * It has the interface of a (const) std::set of SCell, so that it
+   * can replace KSpace::SurfelSet as the storage of SetOfSurfels, and
+   * thus of DigitalSurface. Iterators give the cells by value. Cells
+   * outside the space, which can't be packed, are never in the set:
+   * they are not inserted and never found.
+   *
+   * @code
+   * typedef PackedSurfelSet< KSpace > SurfelSet;
+   * typedef SetOfSurfels< KSpace, SurfelSet > SurfelContainer;
+   * SurfelSet surfels( K );
+   * Surfaces<KSpace>::sMakeBoundary( surfels, K, image, lower, upper );
+   * DigitalSurface< SurfelContainer > surface( new SurfelContainer( K, surfAdj, surfels ) );
+   * @endcode
+   *
+   * @tparam TKSpace a KhalimskySpaceND whose cells can be packed (see
+   * KhalimskyCellPacker::isValid).
+   *
+   * @see KhalimskyCellPacker, testPackedKhalimskyCell.cpp
+   */
+  template <typename TKSpace>
+  class PackedSurfelSet
+  {
+  public:
+    typedef TKSpace KSpace;
+    typedef KhalimskyCellPacker<KSpace> Packer;
+    typedef typename KSpace::SCell SCell;
+    typedef typename Packer::PackedSCell PackedSCell;
+    typedef std::unordered_set<PackedSCell> Container;
+
+    /// Unpacks the cells of the set.
+    struct Unpacker
+    {
+      const Packer * packer = nullptr;
+      SCell operator()( const PackedSCell & pc ) const { return packer->unpack( pc ); }
+    };
+
+    typedef SCell key_type;
+    typedef SCell value_type;
+    typedef std::size_t size_type;
+    typedef boost::transform_iterator< Unpacker, typename Container::const_iterator, SCell, SCell >
+    const_iterator;
+    typedef const_iterator iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Default constructor. The set can't be used until it is assigned
+     * a set built from a space.
+     */
+    PackedSurfelSet() = default;
+
+    /**
+     * Constructor. The set is empty.
+     *
+     * @param aKSpace the space of the cells, whose cells can be packed.
+     */
+    PackedSurfelSet( ConstAlias<KSpace> aKSpace );
+
+    // ----------------------- Set services -----------------------------------
+  public:
+
+    /// @return the number of cells.
+    size_type size() const;
+
+    /// @return 'true' if the set is empty.
+    bool empty() const;
+
+    /// Removes all the cells.
+    void clear();
+
+    /// @param n a number of cells to reserve memory for.
+    void reserve( size_type n );
+
+    /// @return an iterator on the first cell.
+    const_iterator begin() const;
+
+    /// @return an iterator after the last cell.
+    const_iterator end() const;
+
+    /**
+     * Inserts a cell.
+     * @param s any signed cell.
+     * @return an iterator on the cell and 'true' if it was inserted,
+     * or end() and 'false' if the cell is outside the space.
+     */
+    std::pair<const_iterator, bool> insert( const SCell & s );
+
+    /**
+     * Inserts a hint-less cell, for std::inserter.
+     * @param hint unused.
+     * @param s any signed cell.
+     * @return an iterator on the cell, or end() if it is outside the space.
+     */
+    const_iterator insert( const_iterator hint, const SCell & s );
+
+    /**
+     * Inserts a range of cells. Those outside the space are ignored.
+     * @tparam TInputIterator an iterator on signed cells.
+     * @param first an iterator on the first cell.
+     * @param last an iterator after the last cell.
+     */
+    template <typename TInputIterator>
+    void insert( TInputIterator first, TInputIterator last );
+
+    /**
+     * @param s any signed cell.
+     * @return the number of removed cells (0 or 1).
+     */
+    size_type erase( const SCell & s );
+
+    /**
+     * @param s any signed cell.
+     * @return an iterator on the cell, or end() if it is not in the set.
+     */
+    const_iterator find( const SCell & s ) const;
+
+    /**
+     * @param s any signed cell.
+     * @return 1 if the cell is in the set, 0 otherwise.
+     */
+    size_type count( const SCell & s ) const;
+
+    /// @return the packer of the cells.
+    const Packer & packer() const;
+
+    /// @return the packed cells.
+    const Container & container() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// @return an iterator on the cell pointed by @a it.
+    const_iterator makeIterator( typename Container::const_iterator it ) const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Packs and unpacks the cells.
+    Packer myPacker;
+
+    /// The packed cells.
+    Container myCells;
+
+  }; // end of class PackedSurfelSet
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'PackedSurfelSet'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'PackedSurfelSet' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const PackedSurfelSet<TKSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/PackedSurfelSet.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PackedSurfelSet_h
+
+#undef PackedSurfelSet_RECURSES
+#endif // else defined(PackedSurfelSet_RECURSES)
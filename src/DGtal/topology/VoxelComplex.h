@@ -418,9 +418,11 @@ class VoxelComplex : public CubicalComplex<TKSpace, TCellContainer> {
      * @param verbose print messages
      *
      * @return CliqueContainer with the computed cliques for the specified
-     * dimension.
+     * dimension, in the order of the cells of \a cubical.
      *
-     * @note it uses OpenMP if available.
+     * @note cells are tested in parallel, by blocks of consecutive
+     * cells, using ThreadPool::defaultPool. The result does not depend
+     * on the number of threads.
      */
     CliqueContainer criticalCliquesForD(const Dimension d,
                                         const Parent &cubical,
@@ -49,6 +49,29 @@ namespace DGtal
 {
   namespace functions {
 
+    /**
+     * Asymetric thinning of a voxel complex: at each generation, a
+     * voxel chosen by \a Select is kept in each critical clique (from
+     * dimension 3 down to 0), the other simple voxels being removed.
+     * Kept voxels satisfying \a Skel are never removed afterwards.
+     *
+     * Critical cliques are computed in parallel, by blocks of cells
+     * (see VoxelComplex::criticalCliquesForD), and \a Skel is evaluated
+     * in parallel on the kept voxels, using ThreadPool::defaultPool.
+     * \a Select is called sequentially, in the order of the cliques,
+     * hence the result is the one of a serial thinning, whatever the
+     * number of threads.
+     *
+     * @tparam TComplex a VoxelComplex.
+     * @param vc input complex.
+     * @param Select chooses the voxel kept in a critical clique.
+     * @param Skel predicate of voxels to preserve, which must be safe
+     * to call concurrently (as are skelUltimate, skelEnd, skelSimple,
+     * skelIsthmus and skelWithTable).
+     * @param verbose print messages.
+     *
+     * @return the thinned complex.
+     */
     template < typename TComplex >
     TComplex
     asymetricThinningScheme(
@@ -65,6 +88,25 @@ namespace DGtal
        bool verbose = false
     );
 
+    /**
+     * Asymetric thinning of a voxel complex (see asymetricThinningScheme)
+     * in which kept voxels are preserved only if they satisfy \a Skel for
+     * at least \a persistence generations.
+     *
+     * Parallelism is the same as in asymetricThinningScheme: \a Skel
+     * must be safe to call concurrently, and the result does not
+     * depend on the number of threads.
+     *
+     * @tparam TComplex a VoxelComplex.
+     * @param vc input complex.
+     * @param Select chooses the voxel kept in a critical clique.
+     * @param Skel predicate of voxels to preserve.
+     * @param persistence the number of generations a voxel must
+     * satisfy \a Skel to be preserved.
+     * @param verbose print messages.
+     *
+     * @return the thinned complex.
+     */
     template < typename TComplex >
     TComplex
     persistenceAsymetricThinningScheme(
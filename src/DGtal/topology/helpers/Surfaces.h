@@ -43,6 +43,7 @@
 #include <iostream>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/Exceptions.h"
+#include "DGtal/base/ThreadPool.h"
 #include "DGtal/topology/SurfelAdjacency.h"
 #include "DGtal/topology/SurfelNeighborhood.h"
 
@@ -717,6 +718,78 @@ namespace DGtal
                         const Point & aLowerBound, 
                         const Point & aUpperBound  );
 
+    /**
+       Creates the sorted range of signed surfels whose elements
+       represents all the boundary components of a digital shape
+       described by the predicate [pp], i.e. the same surfels as
+       sMakeBoundary. The index of a surfel is its position in the
+       range, which can be found by dichotomy.
+
+       The bounds are cut in slabs along the last axis, which are
+       scanned by the threads of the default ThreadPool. The sorted
+       slabs are then merged pairwise in parallel.
+       
+       @tparam PointPredicate a model of concepts::CPointPredicate
+       describing the inside of a digital shape. It is evaluated
+       concurrently by several threads, and must thus be thread-safe:
+       predicates reading an image or a digital set are, those
+       modifying a state when called (e.g. a cache or a counter) are
+       not.
+       
+       @param aBoundary (modified) the sorted range of surfels.
+       @param aKSpace any space.
+       @param pp an instance of a model of concepts::CPointPredicate, for
+       instance a SetPredicate for a digital set representing a shape.
+
+       @param aLowerBound and @param aUpperBound points giving the
+       bounds of the extracted boundary.
+    */
+    template <typename PointPredicate >
+    static 
+    void sMakeIndexedBoundary( std::vector<SCell> & aBoundary,
+                               const KSpace & aKSpace,
+                               const PointPredicate & pp,
+                               const Point & aLowerBound, 
+                               const Point & aUpperBound  );
+
+    /**
+       Extracts in parallel all the connected boundary components of a
+       digital shape described by the predicate [pp]. The surfels are
+       given by sMakeIndexedBoundary, then each surfel is linked to its
+       neighbors on the boundary (see
+       SurfelNeighborhood::getAdjacentOnPointPredicate) in a concurrent
+       union-find structure.
+
+       Each component is the surfel set that trackBoundary would
+       return from any of its surfels, as a sorted range. Components
+       are sorted by their smallest surfel, which is thus the
+       surfel a serial extraction would have started from.
+
+       @tparam PointPredicate a model of concepts::CPointPredicate
+       describing the inside of a digital shape. It is evaluated
+       concurrently by several threads, and must thus be thread-safe:
+       predicates reading an image or a digital set are, those
+       modifying a state when called (e.g. a cache or a counter) are
+       not.
+
+       @param aComponents (modified) the boundary components.
+       @param aKSpace any space.
+       @param aSurfelAdj the surfel adjacency chosen for the tracking.
+       @param pp an instance of a model of concepts::CPointPredicate, for
+       instance a SetPredicate for a digital set representing a shape.
+
+       @param aLowerBound and @param aUpperBound points giving the
+       bounds of the extracted boundary.
+    */
+    template <typename PointPredicate >
+    static 
+    void sMakeBoundaryComponents( std::vector< std::vector<SCell> > & aComponents,
+                                  const KSpace & aKSpace,
+                                  const SurfelAdjacency<KSpace::dimension> & aSurfelAdj,
+                                  const PointPredicate & pp,
+                                  const Point & aLowerBound, 
+                                  const Point & aUpperBound  );
+
     /**
        Writes on the output iterator @a out_it the unsigned surfels
        whose elements represents all the boundary elements of a